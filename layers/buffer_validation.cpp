@@ -4470,7 +4470,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
     if (disabled[image_layout_validation]) return false;
     bool skip = false;
     // Iterate over the layout maps for each referenced image
-    GlobalImageLayoutRangeMap empty_map(1);
+    const GlobalImageLayoutMap &const_overlay_layout_map = overlayLayoutMap;
     for (const auto &layout_map_entry : pCB->image_layout_map) {
         const auto *image_state = layout_map_entry.first;
         const auto &subres_map = layout_map_entry.second;
@@ -4478,10 +4478,21 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
         // Validate the initial_uses for each subresource referenced
         if (layout_map.empty()) continue;
 
-        auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
         const auto *global_map = image_state->layout_range_map.get();
         assert(global_map);
         auto global_map_guard = global_map->ReadLock();
+        const auto global_version = global_map->GetVersion();
+
+        // A resubmission of an unchanged command buffer doesn't need the merge against the global layouts if they haven't
+        // changed since the command buffer was last found valid against them, and since its own layouts were spliced in.
+        // The latter means the global map already holds them, so there is nothing to add to the overlay either.
+        if (subres_map->ValidatedAgainst(global_version) && subres_map->SplicedInto(global_version) &&
+            !GetLayoutRangeMap(const_overlay_layout_map, *image_state)) {
+            continue;
+        }
+
+        auto *overlay_map = GetLayoutRangeMap(overlayLayoutMap, *image_state);
+        bool layout_mismatch = false;
 
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
@@ -4512,6 +4523,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                 const auto aspect_mask = image_state->subresource_encoder.Decode(intersected_range.begin).aspectMask;
                 bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
                 if (!matches) {
+                    layout_mismatch = true;
                     // We can report all the errors for the intersected range directly
                     for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
@@ -4534,6 +4546,10 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                 }
             }
         }
+        // Only a check against the global layouts alone can be reused
+        if (!layout_mismatch && overlay_map->empty()) {
+            subres_map->SetValidatedAgainst(global_version);
+        }
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
     }
@@ -4545,8 +4561,14 @@ void CoreChecks::UpdateCmdBufImageLayouts(CMD_BUFFER_STATE *pCB) {
     for (const auto &layout_map_entry : pCB->image_layout_map) {
         const auto *image_state = layout_map_entry.first;
         const auto &subres_map = layout_map_entry.second;
-        auto guard = image_state->layout_range_map->WriteLock();
-        sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+        auto *global_map = image_state->layout_range_map.get();
+        auto guard = global_map->WriteLock();
+        // Splicing the same layouts again into an unchanged map is a no-op
+        if (subres_map->SplicedInto(global_map->GetVersion())) continue;
+        if (sparse_container::splice(*global_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater())) {
+            global_map->UpdateVersion();
+        }
+        subres_map->SetSplicedInto(global_map->GetVersion());
     }
 }
 
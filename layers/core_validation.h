@@ -553,26 +553,31 @@ class CoreChecks : public ValidationStateTracker {
 
     // Validate contents of a CopyUpdate
     using DescriptorSet = cvdescriptorset::DescriptorSet;
+    using UpdateStateCache = cvdescriptorset::UpdateStateCache;
     bool ValidateCopyUpdate(const VkCopyDescriptorSet* update, const DescriptorSet* dst_set, const DescriptorSet* src_set,
-                            const char* func_name, std::string* error_code, std::string* error_msg) const;
+                            UpdateStateCache* state_cache, const char* func_name, std::string* error_code,
+                            std::string* error_msg) const;
     bool VerifyCopyUpdateContents(const VkCopyDescriptorSet* update, const DescriptorSet* src_set, VkDescriptorType src_type,
                                   uint32_t src_index, const DescriptorSet* dst_set, VkDescriptorType dst_type, uint32_t dst_index,
-                                  const char* func_name, std::string* error_code, std::string* error_msg) const;
+                                  UpdateStateCache* state_cache, const char* func_name, std::string* error_code,
+                                  std::string* error_msg) const;
     // Validate contents of a WriteUpdate
-    bool ValidateWriteUpdate(const DescriptorSet* descriptor_set, const VkWriteDescriptorSet* update, const char* func_name,
-                             std::string* error_code, std::string* error_msg, bool push) const;
+    bool ValidateWriteUpdate(const DescriptorSet* descriptor_set, const VkWriteDescriptorSet* update, UpdateStateCache* state_cache,
+                             const char* func_name, std::string* error_code, std::string* error_msg, bool push) const;
     bool VerifyWriteUpdateContents(const DescriptorSet* dest_set, const VkWriteDescriptorSet* update, const uint32_t index,
-                                   const char* func_name, std::string* error_code, std::string* error_msg, bool push) const;
+                                   UpdateStateCache* state_cache, const char* func_name, std::string* error_code,
+                                   std::string* error_msg, bool push) const;
     // Shared helper functions - These are useful because the shared sampler image descriptor type
     //  performs common functions with both sampler and image descriptors so they can share their common functions
-    bool ValidateImageUpdate(VkImageView, VkImageLayout, VkDescriptorType, const char* func_name, std::string*, std::string*) const;
+    bool ValidateImageUpdate(VkImageView, VkImageLayout, VkDescriptorType, UpdateStateCache* state_cache, const char* func_name,
+                             std::string*, std::string*) const;
     // Validate contents of a push descriptor update
     bool ValidatePushDescriptorsUpdate(const DescriptorSet* push_set, uint32_t write_count, const VkWriteDescriptorSet* p_wds,
                                        const char* func_name) const;
     // Descriptor Set Validation Functions
-    bool ValidateSampler(VkSampler) const;
-    bool ValidateBufferUpdate(VkDescriptorBufferInfo const* buffer_info, VkDescriptorType type, const char* func_name,
-                              std::string* error_code, std::string* error_msg) const;
+    bool ValidateSampler(VkSampler, UpdateStateCache* state_cache) const;
+    bool ValidateBufferUpdate(VkDescriptorBufferInfo const* buffer_info, VkDescriptorType type, UpdateStateCache* state_cache,
+                              const char* func_name, std::string* error_code, std::string* error_msg) const;
     template <typename T>
     bool ValidateAccelerationStructureUpdate(T acc, const char* func_name, std::string* error_code, std::string* error_msg) const;
     bool ValidateUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet, const UPDATE_TEMPLATE_STATE* template_state,
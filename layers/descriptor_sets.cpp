@@ -502,14 +502,29 @@ void cvdescriptorset::DescriptorSet::Destroy() {
     }
     BASE_NODE::Destroy();
 }
+
+void cvdescriptorset::DescriptorSet::ResetPushDescriptorSet() {
+    assert(IsPushDescriptor());
+    some_update_ = false;
+    for (auto &binding : bindings_) {
+        some_update_ |= binding->Reset(this);
+    }
+    // The set may be rebound at the bind point it was last used at, so the cached validation for it has to be dirtied.
+    change_count_++;
+    push_descriptor_set_writes.clear();
+}
+
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStateTracker *dev_data, uint32_t write_count,
                                                                   const VkWriteDescriptorSet *p_wds) {
     assert(IsPushDescriptor());
+    UpdateStateCache state_cache(dev_data);
     for (uint32_t i = 0; i < write_count; i++) {
-        PerformWriteUpdate(dev_data, &p_wds[i]);
+        PerformWriteUpdate(&state_cache, &p_wds[i]);
     }
 
+    // Only GPU-AV replays the pushed writes, don't make deep copies of them otherwise
+    if (!dev_data->enabled[gpu_validation]) return;
     push_descriptor_set_writes.clear();
     push_descriptor_set_writes.reserve(static_cast<std::size_t>(write_count));
     for (uint32_t i = 0; i < write_count; i++) {
@@ -518,7 +533,7 @@ void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(ValidationStat
 }
 
 // Perform write update in given update struct
-void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *update) {
+void cvdescriptorset::DescriptorSet::PerformWriteUpdate(UpdateStateCache *state_cache, const VkWriteDescriptorSet *update) {
     // Perform update on a per-binding basis as consecutive updates roll over to next binding
     auto descriptors_remaining = update->descriptorCount;
     auto iter = FindDescriptor(update->dstBinding, update->dstArrayElement);
@@ -530,7 +545,7 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(ValidationStateTracker *
         if (iter.AtEnd() || !orig_binding.IsConsistent(iter.CurrentBinding())) {
             break;
         }
-        iter->WriteUpdate(this, state_data_, update, i, iter.CurrentBinding().IsBindless());
+        iter->WriteUpdate(this, state_cache, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
     }
     if (update->descriptorCount) {
@@ -738,11 +753,10 @@ static void ReplaceStatePtr(DescriptorSet *set_state, T &dst, const T &src, bool
     }
 }
 
-void cvdescriptorset::SamplerDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::SamplerDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                      const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data->GetConstCastShared<SAMPLER_STATE>(update->pImageInfo[index].sampler),
-                        is_bindless);
+        ReplaceStatePtr(set_state, sampler_state_, state_cache->GetSampler(update->pImageInfo[index].sampler), is_bindless);
     }
 }
 
@@ -761,16 +775,15 @@ void cvdescriptorset::SamplerDescriptor::CopyUpdate(DescriptorSet *set_state, co
     }
 }
 
-void cvdescriptorset::ImageSamplerDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::ImageSamplerDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                           const VkWriteDescriptorSet *update, const uint32_t index,
                                                           bool is_bindless) {
     const auto &image_info = update->pImageInfo[index];
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data->GetConstCastShared<SAMPLER_STATE>(image_info.sampler), is_bindless);
+        ReplaceStatePtr(set_state, sampler_state_, state_cache->GetSampler(image_info.sampler), is_bindless);
     }
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                    is_bindless);
+    ReplaceStatePtr(set_state, image_view_state_, state_cache->GetImageView(image_info.imageView), is_bindless);
 }
 
 void cvdescriptorset::ImageSamplerDescriptor::CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
@@ -790,12 +803,11 @@ void cvdescriptorset::ImageSamplerDescriptor::CopyUpdate(DescriptorSet *set_stat
     ImageDescriptor::CopyUpdate(set_state, dev_data, src, is_bindless);
 }
 
-void cvdescriptorset::ImageDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::ImageDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                    const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     const auto &image_info = update->pImageInfo[index];
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                    is_bindless);
+    ReplaceStatePtr(set_state, image_view_state_, state_cache->GetImageView(image_info.imageView), is_bindless);
 }
 
 void cvdescriptorset::ImageDescriptor::CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
@@ -821,12 +833,12 @@ void cvdescriptorset::ImageDescriptor::UpdateDrawState(ValidationStateTracker *d
     }
 }
 
-void cvdescriptorset::BufferDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::BufferDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                     const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     const auto &buffer_info = update->pBufferInfo[index];
     offset_ = buffer_info.offset;
     range_ = buffer_info.range;
-    auto buffer_state = dev_data->GetConstCastShared<BUFFER_STATE>(buffer_info.buffer);
+    auto buffer_state = state_cache->GetBuffer(buffer_info.buffer);
     ReplaceStatePtr(set_state, buffer_state_, buffer_state, is_bindless);
 }
 
@@ -845,9 +857,9 @@ void cvdescriptorset::BufferDescriptor::CopyUpdate(DescriptorSet *set_state, con
     ReplaceStatePtr(set_state, buffer_state_, buff_desc->buffer_state_, is_bindless);
 }
 
-void cvdescriptorset::TexelDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::TexelDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                    const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
-    auto buffer_view = dev_data->GetConstCastShared<BUFFER_VIEW_STATE>(update->pTexelBufferView[index]);
+    auto buffer_view = state_cache->GetBufferView(update->pTexelBufferView[index]);
     ReplaceStatePtr(set_state, buffer_view_state_, buffer_view, is_bindless);
 }
 
@@ -861,7 +873,7 @@ void cvdescriptorset::TexelDescriptor::CopyUpdate(DescriptorSet *set_state, cons
     ReplaceStatePtr(set_state, buffer_view_state_, static_cast<const TexelDescriptor *>(src)->buffer_view_state_, is_bindless);
 }
 
-void cvdescriptorset::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                                    const VkWriteDescriptorSet *update, const uint32_t index,
                                                                    bool is_bindless) {
     const auto *acc_info = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureKHR>(update->pNext);
@@ -870,10 +882,10 @@ void cvdescriptorset::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet
     is_khr_ = (acc_info != NULL);
     if (is_khr_) {
         acc_ = acc_info->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE_KHR>(acc_), is_bindless);
+        ReplaceStatePtr(set_state, acc_state_, state_cache->GetAccelerationStructureKHR(acc_), is_bindless);
     } else {
         acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_nv_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE>(acc_nv_), is_bindless);
+        ReplaceStatePtr(set_state, acc_state_nv_, state_cache->GetAccelerationStructureNV(acc_nv_), is_bindless);
     }
 }
 
@@ -913,39 +925,36 @@ cvdescriptorset::MutableDescriptor::MutableDescriptor()
       is_khr_(false),
       acc_(VK_NULL_HANDLE) {}
 
-void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data,
+void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache,
                                                      const VkWriteDescriptorSet *update, const uint32_t index, bool is_bindless) {
     VkDeviceSize buffer_size = 0;
     switch (DescriptorTypeToClass(update->descriptorType)) {
         case DescriptorClass::PlainSampler:
             if (!immutable_) {
                 ReplaceStatePtr(set_state, sampler_state_,
-                                dev_data->GetConstCastShared<SAMPLER_STATE>(update->pImageInfo[index].sampler), is_bindless);
+                                state_cache->GetSampler(update->pImageInfo[index].sampler), is_bindless);
             }
             break;
         case DescriptorClass::ImageSampler: {
             const auto &image_info = update->pImageInfo[index];
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_, dev_data->GetConstCastShared<SAMPLER_STATE>(image_info.sampler),
-                                is_bindless);
+                ReplaceStatePtr(set_state, sampler_state_, state_cache->GetSampler(image_info.sampler), is_bindless);
             }
             image_layout_ = image_info.imageLayout;
-            ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                            is_bindless);
+            ReplaceStatePtr(set_state, image_view_state_, state_cache->GetImageView(image_info.imageView), is_bindless);
             break;
         }
         case DescriptorClass::Image: {
             const auto &image_info = update->pImageInfo[index];
             image_layout_ = image_info.imageLayout;
-            ReplaceStatePtr(set_state, image_view_state_, dev_data->GetConstCastShared<IMAGE_VIEW_STATE>(image_info.imageView),
-                            is_bindless);
+            ReplaceStatePtr(set_state, image_view_state_, state_cache->GetImageView(image_info.imageView), is_bindless);
             break;
         }
         case DescriptorClass::GeneralBuffer: {
             const auto &buffer_info = update->pBufferInfo[index];
             offset_ = buffer_info.offset;
             range_ = buffer_info.range;
-            const auto buffer_state = dev_data->GetConstCastShared<BUFFER_STATE>(update->pBufferInfo->buffer);
+            const auto buffer_state = state_cache->GetBuffer(update->pBufferInfo->buffer);
             if (buffer_state) {
                 buffer_size = buffer_state->createInfo.size;
             }
@@ -953,7 +962,7 @@ void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, c
             break;
         }
         case DescriptorClass::TexelBuffer: {
-            const auto buffer_view = dev_data->GetConstCastShared<BUFFER_VIEW_STATE>(update->pTexelBufferView[index]);
+            const auto buffer_view = state_cache->GetBufferView(update->pTexelBufferView[index]);
             if (buffer_view) {
                 buffer_size = buffer_view->buffer_state->createInfo.size;
             }
@@ -967,12 +976,10 @@ void cvdescriptorset::MutableDescriptor::WriteUpdate(DescriptorSet *set_state, c
             is_khr_ = (acc_info != NULL);
             if (is_khr_) {
                 acc_ = acc_info->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE_KHR>(acc_),
-                                is_bindless);
+                ReplaceStatePtr(set_state, acc_state_, state_cache->GetAccelerationStructureKHR(acc_), is_bindless);
             } else {
                 acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_nv_, dev_data->GetConstCastShared<ACCELERATION_STRUCTURE_STATE>(acc_nv_),
-                                is_bindless);
+                ReplaceStatePtr(set_state, acc_state_nv_, state_cache->GetAccelerationStructureNV(acc_nv_), is_bindless);
             }
             break;
         }
@@ -1173,6 +1180,63 @@ bool cvdescriptorset::MutableDescriptor::Invalid() const {
     }
 }
 
+template <typename State, typename Handle>
+std::shared_ptr<State> cvdescriptorset::UpdateStateCache::Lookup(StateMap<State, Handle> &map, Handle handle) {
+    if (map.contains(handle)) {
+        return map[handle];
+    }
+    auto state = dev_data_->GetConstCastShared<State>(handle);
+    map[handle] = state;
+    return state;
+}
+
+std::shared_ptr<DescriptorSet> cvdescriptorset::UpdateStateCache::GetDescriptorSet(VkDescriptorSet set) {
+    return Lookup(sets_, set);
+}
+
+std::shared_ptr<SAMPLER_STATE> cvdescriptorset::UpdateStateCache::GetSampler(VkSampler sampler) {
+    return Lookup(samplers_, sampler);
+}
+
+std::shared_ptr<IMAGE_VIEW_STATE> cvdescriptorset::UpdateStateCache::GetImageView(VkImageView image_view) {
+    return Lookup(image_views_, image_view);
+}
+
+std::shared_ptr<BUFFER_STATE> cvdescriptorset::UpdateStateCache::GetBuffer(VkBuffer buffer) { return Lookup(buffers_, buffer); }
+
+std::shared_ptr<BUFFER_VIEW_STATE> cvdescriptorset::UpdateStateCache::GetBufferView(VkBufferView buffer_view) {
+    return Lookup(buffer_views_, buffer_view);
+}
+
+std::shared_ptr<ACCELERATION_STRUCTURE_STATE_KHR> cvdescriptorset::UpdateStateCache::GetAccelerationStructureKHR(
+    VkAccelerationStructureKHR acc) {
+    return Lookup(acc_structs_khr_, acc);
+}
+
+std::shared_ptr<ACCELERATION_STRUCTURE_STATE> cvdescriptorset::UpdateStateCache::GetAccelerationStructureNV(
+    VkAccelerationStructureNV acc) {
+    return Lookup(acc_structs_nv_, acc);
+}
+
+cvdescriptorset::DescriptorWriteOrder cvdescriptorset::GroupDescriptorWrites(uint32_t write_count,
+                                                                             const VkWriteDescriptorSet *p_wds,
+                                                                             bool group_bindings) {
+    DescriptorWriteOrder order;
+    order.reserve(write_count);
+    for (uint32_t i = 0; i < write_count; ++i) {
+        order.emplace_back(i);
+    }
+    const auto less = [p_wds, group_bindings](uint32_t a, uint32_t b) {
+        if (p_wds[a].dstSet != p_wds[b].dstSet) return std::less<VkDescriptorSet>()(p_wds[a].dstSet, p_wds[b].dstSet);
+        return group_bindings && (p_wds[a].dstBinding < p_wds[b].dstBinding);
+    };
+    // Most batches already arrive grouped (a decoded template update only ever targets one set), so skip the sort for those
+    if (!std::is_sorted(order.begin(), order.end(), less)) {
+        std::stable_sort(order.begin(), order.end(), less);
+    }
+    return order;
+}
+
 // This is a helper function that iterates over a set of Write and Copy updates, pulls the DescriptorSet* for updated
 //  sets, and then calls their respective Perform[Write|Copy]Update functions.
 // Prerequisite : ValidateUpdateDescriptorSets() should be called and return "false" prior to calling PerformUpdateDescriptorSets()
@@ -1182,21 +1246,19 @@ bool cvdescriptorset::MutableDescriptor::Invalid() const {
 void cvdescriptorset::PerformUpdateDescriptorSets(ValidationStateTracker *dev_data, uint32_t write_count,
                                                   const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                                   const VkCopyDescriptorSet *p_cds) {
+    // Every set, view, buffer and sampler named by the batch is looked up once, and the writes are applied set by set
+    UpdateStateCache state_cache(dev_data);
     // Write updates first
-    uint32_t i = 0;
-    for (i = 0; i < write_count; ++i) {
-        auto dest_set = p_wds[i].dstSet;
-        auto set_node = dev_data->Get<cvdescriptorset::DescriptorSet>(dest_set);
+    for (const auto i : GroupDescriptorWrites(write_count, p_wds, false)) {
+        auto set_node = state_cache.GetDescriptorSet(p_wds[i].dstSet);
         if (set_node) {
-            set_node->PerformWriteUpdate(dev_data, &p_wds[i]);
+            set_node->PerformWriteUpdate(&state_cache, &p_wds[i]);
         }
     }
     // Now copy updates
-    for (i = 0; i < copy_count; ++i) {
-        auto dst_set = p_cds[i].dstSet;
-        auto src_set = p_cds[i].srcSet;
-        auto src_node = dev_data->Get<cvdescriptorset::DescriptorSet>(src_set);
-        auto dst_node = dev_data->Get<cvdescriptorset::DescriptorSet>(dst_set);
+    for (uint32_t i = 0; i < copy_count; ++i) {
+        auto src_node = state_cache.GetDescriptorSet(p_cds[i].srcSet);
+        auto dst_node = state_cache.GetDescriptorSet(p_cds[i].dstSet);
         if (src_node && dst_node) {
             dst_node->PerformCopyUpdate(dev_data, &p_cds[i], src_node.get());
         }
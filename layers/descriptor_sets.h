@@ -49,6 +49,7 @@ class SAMPLER_STATE;
 
 namespace cvdescriptorset {
 class DescriptorSet;
+class DescriptorSetLayout;
 struct AllocateDescriptorSetsData;
 }
 
@@ -89,12 +90,43 @@ class DESCRIPTOR_POOL_STATE : public BASE_NODE {
     mutable ReadWriteLock lock_;
 };
 
+// A descriptor update template resolved against a set layout: one single descriptor write per descriptor the template
+// updates, with binding, array element and type already worked out. Only dstSet and the pointers into the application's
+// data differ between updates, and Decode() fills those in.
+struct TemplateUpdatePlan {
+    struct Write {
+        VkWriteDescriptorSet write;
+        size_t offset;  // of the descriptor's data within pData
+        uint32_t entry;  // index of the VkDescriptorUpdateTemplateEntry the write came from
+    };
+    std::vector<Write> writes;
+    // Inline uniform block and acceleration structure writes carry their data in a pNext struct
+    bool needs_inline_infos = false;
+
+    TemplateUpdatePlan() = default;
+    TemplateUpdatePlan(const cvdescriptorset::DescriptorSetLayout &layout,
+                       const safe_VkDescriptorUpdateTemplateCreateInfo &create_info);
+
+    // Produces writes[index] for an update of set from pData. The inline struct matching the write's descriptor type is
+    // filled in and chained to the write, so it must outlive it; the others may be null.
+    void Decode(size_t index, VkDescriptorSet set, const void *pData, VkWriteDescriptorSet *write,
+                VkWriteDescriptorSetInlineUniformBlockEXT *inline_info,
+                VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr,
+                VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv) const;
+};
+
 class UPDATE_TEMPLATE_STATE : public BASE_NODE {
   public:
     const safe_VkDescriptorUpdateTemplateCreateInfo create_info;
-
-    UPDATE_TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : BASE_NODE(update_template, kVulkanObjectTypeDescriptorUpdateTemplate), create_info(pCreateInfo) {}
+    // Built once at creation for VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET templates. Push descriptor templates are
+    // resolved against the layout bound at each push instead, so theirs stays empty.
+    const TemplateUpdatePlan plan;
+
+    UPDATE_TEMPLATE_STATE(VkDescriptorUpdateTemplate update_template, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                          const cvdescriptorset::DescriptorSetLayout *layout)
+        : BASE_NODE(update_template, kVulkanObjectTypeDescriptorUpdateTemplate),
+          create_info(pCreateInfo),
+          plan(layout ? TemplateUpdatePlan(*layout, create_info) : TemplateUpdatePlan()) {}
 };
 
 // Descriptor Data structures
@@ -328,11 +360,48 @@ DescriptorClass DescriptorTypeToClass(VkDescriptorType type);
 
 class DescriptorSet;
 
+// Memoizes the state object lookups made while validating or performing one batch of descriptor updates. Batches
+// usually write the same few sets, views, buffers and samplers into many descriptors, so each handle only goes through
+// the device's state maps once. Missing objects are remembered too.
+class UpdateStateCache {
+  public:
+    explicit UpdateStateCache(const ValidationStateTracker *dev_data) : dev_data_(dev_data) {}
+
+    std::shared_ptr<DescriptorSet> GetDescriptorSet(VkDescriptorSet set);
+    std::shared_ptr<SAMPLER_STATE> GetSampler(VkSampler sampler);
+    std::shared_ptr<IMAGE_VIEW_STATE> GetImageView(VkImageView image_view);
+    std::shared_ptr<BUFFER_STATE> GetBuffer(VkBuffer buffer);
+    std::shared_ptr<BUFFER_VIEW_STATE> GetBufferView(VkBufferView buffer_view);
+    std::shared_ptr<ACCELERATION_STRUCTURE_STATE_KHR> GetAccelerationStructureKHR(VkAccelerationStructureKHR acc);
+    std::shared_ptr<ACCELERATION_STRUCTURE_STATE> GetAccelerationStructureNV(VkAccelerationStructureNV acc);
+
+  private:
+    template <typename State, typename Handle>
+    using StateMap = small_unordered_map<Handle, std::shared_ptr<State>, 8>;
+    template <typename State, typename Handle>
+    std::shared_ptr<State> Lookup(StateMap<State, Handle> &map, Handle handle);
+
+    const ValidationStateTracker *dev_data_;
+    StateMap<DescriptorSet, VkDescriptorSet> sets_;
+    StateMap<SAMPLER_STATE, VkSampler> samplers_;
+    StateMap<IMAGE_VIEW_STATE, VkImageView> image_views_;
+    StateMap<BUFFER_STATE, VkBuffer> buffers_;
+    StateMap<BUFFER_VIEW_STATE, VkBufferView> buffer_views_;
+    StateMap<ACCELERATION_STRUCTURE_STATE_KHR, VkAccelerationStructureKHR> acc_structs_khr_;
+    StateMap<ACCELERATION_STRUCTURE_STATE, VkAccelerationStructureNV> acc_structs_nv_;
+};
+
+// Returns the order to handle the writes of an update batch in, so that writes to the same set (and, with group_bindings,
+// to the same binding) are handled back to back. The sort is stable, so writes landing on the same descriptors keep their
+// relative order. Writes can roll over into the following bindings, so only validation may group by binding.
+using DescriptorWriteOrder = small_vector<uint32_t, 32>;
+DescriptorWriteOrder GroupDescriptorWrites(uint32_t write_count, const VkWriteDescriptorSet *p_wds, bool group_bindings);
+
 class Descriptor {
   public:
     Descriptor() {}
     virtual ~Descriptor() {}
-    virtual void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *,
+    virtual void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *,
                              const uint32_t, bool is_bindless) = 0;
     virtual void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                             bool is_bindless) = 0;
@@ -360,7 +429,7 @@ class SamplerDescriptor : public Descriptor {
   public:
     SamplerDescriptor() = default;
     DescriptorClass GetClass() const override { return PlainSampler; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -400,7 +469,7 @@ class ImageDescriptor : public Descriptor {
   public:
     ImageDescriptor() = default;
     DescriptorClass GetClass() const override { return Image; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -435,7 +504,7 @@ class ImageSamplerDescriptor : public ImageDescriptor {
   public:
     ImageSamplerDescriptor() = default;
     DescriptorClass GetClass() const override { return ImageSampler; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -477,7 +546,7 @@ class TexelDescriptor : public Descriptor {
   public:
     TexelDescriptor() = default;
     DescriptorClass GetClass() const override { return TexelBuffer; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -509,7 +578,7 @@ class BufferDescriptor : public Descriptor {
   public:
     BufferDescriptor() = default;
     DescriptorClass GetClass() const override { return GeneralBuffer; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -544,7 +613,7 @@ class InlineUniformDescriptor : public Descriptor {
   public:
     InlineUniformDescriptor() = default;
     DescriptorClass GetClass() const override { return InlineUniform; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override {}
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override {}
@@ -554,7 +623,7 @@ class AccelerationStructureDescriptor : public Descriptor {
   public:
     AccelerationStructureDescriptor() = default;
     DescriptorClass GetClass() const override { return AccelerationStructure; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     VkAccelerationStructureKHR GetAccelerationStructure() const { return acc_; }
     const ACCELERATION_STRUCTURE_STATE_KHR *GetAccelerationStructureStateKHR() const { return acc_state_.get(); }
@@ -604,7 +673,7 @@ class MutableDescriptor : public Descriptor {
   public:
     MutableDescriptor();
     DescriptorClass GetClass() const override { return Mutable; }
-    void WriteUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const VkWriteDescriptorSet *, const uint32_t,
+    void WriteUpdate(DescriptorSet *set_state, UpdateStateCache *state_cache, const VkWriteDescriptorSet *, const uint32_t,
                      bool is_bindless) override;
     void CopyUpdate(DescriptorSet *set_state, const ValidationStateTracker *dev_data, const Descriptor *,
                     bool is_bindless) override;
@@ -714,6 +783,9 @@ class DescriptorBinding {
 
     virtual void AddParent(DescriptorSet *ds) = 0;
     virtual void RemoveParent(DescriptorSet *ds) = 0;
+    // Return all descriptors to the state they had when the binding was created. Returns true if any of them is still
+    // updated, which is the case for immutable samplers.
+    virtual bool Reset(DescriptorSet *ds) = 0;
 
     virtual const Descriptor *GetDescriptor(const uint32_t index) const = 0;
     virtual Descriptor *GetDescriptor(const uint32_t index) = 0;
@@ -744,6 +816,28 @@ class DescriptorBinding {
     std::vector<bool> updated;
 };
 
+// Used by DescriptorBindingImpl::Reset(), immutable samplers are part of a descriptor's initial state.
+template <typename T>
+inline void ResetDescriptor(T &descriptor) {
+    descriptor = T();
+}
+
+inline void ResetDescriptor(SamplerDescriptor &descriptor) {
+    if (!descriptor.IsImmutableSampler()) {
+        descriptor = SamplerDescriptor();
+    }
+}
+
+inline void ResetDescriptor(ImageSamplerDescriptor &descriptor) {
+    if (descriptor.IsImmutableSampler()) {
+        auto sampler_state = descriptor.GetSharedSamplerState();
+        descriptor = ImageSamplerDescriptor();
+        descriptor.SetSamplerState(std::move(sampler_state));
+    } else {
+        descriptor = ImageSamplerDescriptor();
+    }
+}
+
 template <typename T>
 class DescriptorBindingImpl : public DescriptorBinding {
   public:
@@ -770,6 +864,17 @@ class DescriptorBindingImpl : public DescriptorBinding {
             }
         }
     }
+    bool Reset(DescriptorSet *ds) override {
+        RemoveParent(ds);
+        bool any_updated = false;
+        for (uint32_t i = 0; i < count; i++) {
+            ResetDescriptor(descriptors[i]);
+            const bool is_updated = descriptors[i].IsImmutableSampler();
+            updated[i] = is_updated;
+            any_updated |= is_updated;
+        }
+        return any_updated;
+    }
     std::vector<T> descriptors;
 };
 
@@ -835,10 +940,12 @@ class DescriptorSet : public BASE_NODE {
 
     std::string StringifySetAndLayout() const;
 
+    // Return a push descriptor set to its just-created state, so a command buffer can reuse it for a later push
+    void ResetPushDescriptorSet();
     // Perform a push update whose contents were just validated using ValidatePushDescriptorsUpdate
     void PerformPushDescriptorsUpdate(ValidationStateTracker *dev_data, uint32_t write_count, const VkWriteDescriptorSet *p_wds);
     // Perform a WriteUpdate whose contents were just validated using ValidateWriteUpdate
-    void PerformWriteUpdate(ValidationStateTracker *dev_data, const VkWriteDescriptorSet *);
+    void PerformWriteUpdate(UpdateStateCache *state_cache, const VkWriteDescriptorSet *);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     void PerformCopyUpdate(ValidationStateTracker *dev_data, const VkCopyDescriptorSet *, const DescriptorSet *);
 
@@ -1679,7 +1679,8 @@ static bool VerifyUpdateConsistency(debug_report_data *report_data, const Descri
 
 // Validate Copy update
 bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const DescriptorSet *dst_set, const DescriptorSet *src_set,
-                                    const char *func_name, std::string *error_code, std::string *error_msg) const {
+                                    UpdateStateCache *state_cache, const char *func_name, std::string *error_code,
+                                    std::string *error_msg) const {
     const auto *dst_layout = dst_set->GetLayout().get();
     const auto *src_layout = src_set->GetLayout().get();
 
@@ -1966,8 +1967,8 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
     }
 
     // Update parameters all look good and descriptor updated so verify update contents
-    if (!VerifyCopyUpdateContents(update, src_set, src_type, src_start_idx, dst_set, dst_type, dst_start_idx, func_name, error_code,
-                                  error_msg)) {
+    if (!VerifyCopyUpdateContents(update, src_set, src_type, src_start_idx, dst_set, dst_type, dst_start_idx, state_cache,
+                                  func_name, error_code, error_msg)) {
         return false;
     }
 
@@ -1976,11 +1977,14 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
 }
 
 // Validate given sampler. Currently this only checks to make sure it exists in the samplerMap
-bool CoreChecks::ValidateSampler(const VkSampler sampler) const { return Get<SAMPLER_STATE>(sampler).get() != nullptr; }
+bool CoreChecks::ValidateSampler(const VkSampler sampler, UpdateStateCache *state_cache) const {
+    return state_cache->GetSampler(sampler).get() != nullptr;
+}
 
 bool CoreChecks::ValidateImageUpdate(VkImageView image_view, VkImageLayout image_layout, VkDescriptorType type,
-                                     const char *func_name, std::string *error_code, std::string *error_msg) const {
-    auto iv_state = Get<IMAGE_VIEW_STATE>(image_view);
+                                     UpdateStateCache *state_cache, const char *func_name, std::string *error_code,
+                                     std::string *error_msg) const {
+    auto iv_state = state_cache->GetImageView(image_view);
     assert(iv_state);
 
     // Note that when an imageview is created, we validated that memory is bound so no need to re-check here
@@ -2309,10 +2313,13 @@ bool CoreChecks::ValidateImageUpdate(VkImageView image_view, VkImageLayout image
 bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWriteDescriptorSet *p_wds, uint32_t copy_count,
                                               const VkCopyDescriptorSet *p_cds, const char *func_name) const {
     bool skip = false;
+    // Every set, view, buffer and sampler named by the batch is looked up once, and the writes are validated grouped by set
+    // and binding. Validation doesn't change any state, so the order the writes are checked in doesn't matter.
+    UpdateStateCache state_cache(this);
     // Validate Write updates
-    for (uint32_t i = 0; i < write_count; i++) {
+    for (const auto i : cvdescriptorset::GroupDescriptorWrites(write_count, p_wds, true)) {
         auto dest_set = p_wds[i].dstSet;
-        auto set_node = Get<cvdescriptorset::DescriptorSet>(dest_set);
+        auto set_node = state_cache.GetDescriptorSet(dest_set);
         if (!set_node) {
             skip |= LogError(dest_set, kVUID_Core_DrawState_InvalidDescriptorSet,
                              "Cannot call %s on %s that has not been allocated in pDescriptorWrites[%u].", func_name,
@@ -2320,7 +2327,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
         } else {
             std::string error_code;
             std::string error_str;
-            if (!ValidateWriteUpdate(set_node.get(), &p_wds[i], func_name, &error_code, &error_str, false)) {
+            if (!ValidateWriteUpdate(set_node.get(), &p_wds[i], &state_cache, func_name, &error_code, &error_str, false)) {
                 skip |=
                     LogError(dest_set, error_code, "%s pDescriptorWrites[%u] failed write update validation for %s with error: %s.",
                              func_name, i, report_data->FormatHandle(dest_set).c_str(), error_str.c_str());
@@ -2330,7 +2337,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
             const auto *pnext_struct = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureKHR>(p_wds[i].pNext);
             if (pnext_struct) {
                 for (uint32_t j = 0; j < pnext_struct->accelerationStructureCount; ++j) {
-                    auto as_state = Get<ACCELERATION_STRUCTURE_STATE_KHR>(pnext_struct->pAccelerationStructures[j]);
+                    auto as_state = state_cache.GetAccelerationStructureKHR(pnext_struct->pAccelerationStructures[j]);
                     if (as_state && (as_state->create_infoKHR.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR &&
                                      (as_state->create_infoKHR.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR &&
                                       as_state->create_infoKHR.type != VK_ACCELERATION_STRUCTURE_TYPE_GENERIC_KHR))) {
@@ -2346,7 +2353,7 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
             const auto *pnext_struct_nv = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureNV>(p_wds[i].pNext);
             if (pnext_struct_nv) {
                 for (uint32_t j = 0; j < pnext_struct_nv->accelerationStructureCount; ++j) {
-                    auto as_state = Get<ACCELERATION_STRUCTURE_STATE>(pnext_struct_nv->pAccelerationStructures[j]);
+                    auto as_state = state_cache.GetAccelerationStructureNV(pnext_struct_nv->pAccelerationStructures[j]);
                     if (as_state && (as_state->create_infoNV.sType == VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV &&
                                      as_state->create_infoNV.info.type != VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_NV)) {
                         skip |= LogError(dest_set, "VUID-VkWriteDescriptorSetAccelerationStructureNV-pAccelerationStructures-03748",
@@ -2363,14 +2370,14 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
     for (uint32_t i = 0; i < copy_count; ++i) {
         auto dst_set = p_cds[i].dstSet;
         auto src_set = p_cds[i].srcSet;
-        auto src_node = Get<cvdescriptorset::DescriptorSet>(src_set);
-        auto dst_node = Get<cvdescriptorset::DescriptorSet>(dst_set);
+        auto src_node = state_cache.GetDescriptorSet(src_set);
+        auto dst_node = state_cache.GetDescriptorSet(dst_set);
         // Object_tracker verifies that src & dest descriptor set are valid
         assert(src_node);
         assert(dst_node);
         std::string error_code;
         std::string error_str;
-        if (!ValidateCopyUpdate(&p_cds[i], dst_node.get(), src_node.get(), func_name, &error_code, &error_str)) {
+        if (!ValidateCopyUpdate(&p_cds[i], dst_node.get(), src_node.get(), &state_cache, func_name, &error_code, &error_str)) {
             LogObjectList objlist(dst_set);
             objlist.add(src_set);
             skip |= LogError(objlist, error_code, "%s pDescriptorCopies[%u] failed copy update from %s to %s with error: %s.",
@@ -2381,106 +2388,141 @@ bool CoreChecks::ValidateUpdateDescriptorSets(uint32_t write_count, const VkWrit
     return skip;
 }
 
-cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *device_data,
-                                                              VkDescriptorSet descriptorSet,
-                                                              const UPDATE_TEMPLATE_STATE *template_state, const void *pData,
-                                                              VkDescriptorSetLayout push_layout) {
-    auto const &create_info = template_state->create_info;
-    inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
-    inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
-    inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
-    desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
-    VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
-                                              ? create_info.descriptorSetLayout
-                                              : push_layout;
-    auto layout_obj = device_data->Get<cvdescriptorset::DescriptorSetLayout>(effective_dsl);
+TemplateUpdatePlan::TemplateUpdatePlan(const cvdescriptorset::DescriptorSetLayout &layout,
+                                       const safe_VkDescriptorUpdateTemplateCreateInfo &create_info) {
+    uint32_t write_count = 0;
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        write_count += create_info.pDescriptorUpdateEntries[i].descriptorCount;
+    }
+    writes.reserve(write_count);
 
     // Create a WriteDescriptorSet struct for each template update entry
     for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        auto binding_count = layout_obj->GetDescriptorCountFromBinding(create_info.pDescriptorUpdateEntries[i].dstBinding);
-        auto binding_being_updated = create_info.pDescriptorUpdateEntries[i].dstBinding;
-        auto dst_array_element = create_info.pDescriptorUpdateEntries[i].dstArrayElement;
-
-        desc_writes.reserve(desc_writes.size() + create_info.pDescriptorUpdateEntries[i].descriptorCount);
-        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
-            desc_writes.emplace_back();
-            auto &write_entry = desc_writes.back();
+        const auto &entry = create_info.pDescriptorUpdateEntries[i];
+        auto binding_count = layout.GetDescriptorCountFromBinding(entry.dstBinding);
+        auto binding_being_updated = entry.dstBinding;
+        auto dst_array_element = entry.dstArrayElement;
 
-            size_t offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
-            char *update_entry = (char *)(pData) + offset;
+        for (uint32_t j = 0; j < entry.descriptorCount; j++) {
+            writes.emplace_back();
+            auto &planned = writes.back();
+            planned.offset = entry.offset + j * entry.stride;
+            planned.entry = i;
 
             if (dst_array_element >= binding_count) {
                 dst_array_element = 0;
-                binding_being_updated = layout_obj->GetNextValidBinding(binding_being_updated);
+                binding_being_updated = layout.GetNextValidBinding(binding_being_updated);
             }
 
-            write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            write_entry.pNext = NULL;
-            write_entry.dstSet = descriptorSet;
+            auto &write_entry = planned.write;
+            write_entry = LvlInitStruct<VkWriteDescriptorSet>();
             write_entry.dstBinding = binding_being_updated;
             write_entry.dstArrayElement = dst_array_element;
             write_entry.descriptorCount = 1;
-            write_entry.descriptorType = create_info.pDescriptorUpdateEntries[i].descriptorType;
-
-            switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
-                case VK_DESCRIPTOR_TYPE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-                    write_entry.pImageInfo = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
-                    break;
+            write_entry.descriptorType = entry.descriptorType;
 
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                    write_entry.pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
-                    break;
-
-                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                    write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
-                    break;
-                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
-                    VkWriteDescriptorSetInlineUniformBlockEXT *inline_info = &inline_infos[i];
-                    inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
-                    inline_info->pNext = nullptr;
-                    inline_info->dataSize = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info->pData = update_entry;
-                    write_entry.pNext = inline_info;
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
                     // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlockEXT structure
-                    write_entry.descriptorCount = inline_info->dataSize;
+                    write_entry.descriptorCount = entry.descriptorCount;
                     // skip the rest of the array, they just represent bytes in the update
-                    j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                    j = entry.descriptorCount;
+                    needs_inline_infos = true;
                     break;
-                }
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
-                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[i];
-                    inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
-                    inline_info_khr->pNext = nullptr;
-                    inline_info_khr->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
-                    write_entry.pNext = inline_info_khr;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    needs_inline_infos = true;
                     break;
-                }
-                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
-                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[i];
-                    inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
-                    inline_info_nv->pNext = nullptr;
-                    inline_info_nv->accelerationStructureCount = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
-                    write_entry.pNext = inline_info_nv;
-                    break;
-                }
                 default:
-                    assert(0);
                     break;
             }
             dst_array_element++;
         }
     }
 }
+
+void TemplateUpdatePlan::Decode(size_t index, VkDescriptorSet set, const void *pData, VkWriteDescriptorSet *write,
+                                VkWriteDescriptorSetInlineUniformBlockEXT *inline_info,
+                                VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr,
+                                VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv) const {
+    const auto &planned = writes[index];
+    const void *update_entry = static_cast<const char *>(pData) + planned.offset;
+    *write = planned.write;
+    write->dstSet = set;
+
+    switch (write->descriptorType) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            write->pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(update_entry);
+            break;
+
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            write->pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(update_entry);
+            break;
+
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            write->pTexelBufferView = reinterpret_cast<const VkBufferView *>(update_entry);
+            break;
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            *inline_info = LvlInitStruct<VkWriteDescriptorSetInlineUniformBlockEXT>();
+            inline_info->dataSize = write->descriptorCount;
+            inline_info->pData = update_entry;
+            write->pNext = inline_info;
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+            // Each write updates a single descriptor, so its pNext struct covers just that element of pData
+            *inline_info_khr = LvlInitStruct<VkWriteDescriptorSetAccelerationStructureKHR>();
+            inline_info_khr->accelerationStructureCount = write->descriptorCount;
+            inline_info_khr->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureKHR *>(update_entry);
+            write->pNext = inline_info_khr;
+            break;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            *inline_info_nv = LvlInitStruct<VkWriteDescriptorSetAccelerationStructureNV>();
+            inline_info_nv->accelerationStructureCount = write->descriptorCount;
+            inline_info_nv->pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureNV *>(update_entry);
+            write->pNext = inline_info_nv;
+            break;
+        default:
+            assert(0);
+            break;
+    }
+}
+
+cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *device_data,
+                                                              VkDescriptorSet descriptorSet,
+                                                              const UPDATE_TEMPLATE_STATE *template_state, const void *pData,
+                                                              VkDescriptorSetLayout push_layout) {
+    const TemplateUpdatePlan *plan = &template_state->plan;
+    TemplateUpdatePlan push_plan;
+    if (template_state->create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        // Push descriptor templates are resolved against the layout they are pushed with
+        auto layout_obj = device_data->Get<cvdescriptorset::DescriptorSetLayout>(push_layout);
+        if (layout_obj) {
+            push_plan = TemplateUpdatePlan(*layout_obj, template_state->create_info);
+        }
+        plan = &push_plan;
+    }
+
+    const size_t write_count = plan->writes.size();
+    desc_writes.resize(write_count);
+    if (plan->needs_inline_infos) {
+        inline_infos.resize(write_count);
+        inline_infos_khr.resize(write_count);
+        inline_infos_nv.resize(write_count);
+    }
+    for (size_t i = 0; i < write_count; i++) {
+        plan->Decode(i, descriptorSet, pData, &desc_writes[i], plan->needs_inline_infos ? &inline_infos[i] : nullptr,
+                     plan->needs_inline_infos ? &inline_infos_khr[i] : nullptr,
+                     plan->needs_inline_infos ? &inline_infos_nv[i] : nullptr);
+    }
+}
 // These helper functions carry out the validate and record descriptor updates peformed via update templates. They decode
 // the templatized data and leverage the non-template UpdateDescriptor helper functions.
 bool CoreChecks::ValidateUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
@@ -2512,10 +2554,11 @@ bool CoreChecks::ValidatePushDescriptorsUpdate(const DescriptorSet *push_set, ui
                                                const VkWriteDescriptorSet *p_wds, const char *func_name) const {
     assert(push_set->IsPushDescriptor());
     bool skip = false;
+    UpdateStateCache state_cache(this);
     for (uint32_t i = 0; i < write_count; i++) {
         std::string error_code;
         std::string error_str;
-        if (!ValidateWriteUpdate(push_set, &p_wds[i], func_name, &error_code, &error_str, true)) {
+        if (!ValidateWriteUpdate(push_set, &p_wds[i], &state_cache, func_name, &error_code, &error_str, true)) {
             skip |= LogError(push_set->GetDescriptorSetLayout(), error_code,
                              "%s VkWriteDescriptorSet[%u] failed update validation: %s.", func_name, i, error_str.c_str());
         }
@@ -2578,10 +2621,11 @@ static bool ValidateBufferUsage(debug_report_data *report_data, BUFFER_STATE con
 //  4. range is either VK_WHOLE_SIZE or falls in (0, (buffer size - offset)]
 //  5. range and offset are within the device's limits
 // If there's an error, update the error_msg string with details and return false, else return true
-bool CoreChecks::ValidateBufferUpdate(VkDescriptorBufferInfo const *buffer_info, VkDescriptorType type, const char *func_name,
-                                      std::string *error_code, std::string *error_msg) const {
+bool CoreChecks::ValidateBufferUpdate(VkDescriptorBufferInfo const *buffer_info, VkDescriptorType type,
+                                      UpdateStateCache *state_cache, const char *func_name, std::string *error_code,
+                                      std::string *error_msg) const {
     // First make sure that buffer is valid
-    auto buffer_node = Get<BUFFER_STATE>(buffer_info->buffer);
+    auto buffer_node = state_cache->GetBuffer(buffer_info->buffer);
     // Any invalid buffer should already be caught by object_tracker
     assert(buffer_node);
     if (ValidateMemoryIsBoundToBuffer(buffer_node.get(), func_name, "VUID-VkWriteDescriptorSet-descriptorType-00329")) {
@@ -2687,8 +2731,8 @@ bool CoreChecks::ValidateAccelerationStructureUpdate(T acc_node, const char *fun
 // Verify that the contents of the update are ok, but don't perform actual update
 bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, const DescriptorSet *src_set,
                                           VkDescriptorType src_type, uint32_t src_index, const DescriptorSet *dst_set,
-                                          VkDescriptorType dst_type, uint32_t dst_index, const char *func_name,
-                                          std::string *error_code, std::string *error_msg) const {
+                                          VkDescriptorType dst_type, uint32_t dst_index, UpdateStateCache *state_cache,
+                                          const char *func_name, std::string *error_code, std::string *error_msg) const {
     // Note : Repurposing some Write update error codes here as specific details aren't called out for copy updates like they are
     // for write updates
     using DescriptorClass = cvdescriptorset::DescriptorClass;
@@ -2698,8 +2742,6 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
     using SamplerDescriptor = cvdescriptorset::SamplerDescriptor;
     using TexelDescriptor = cvdescriptorset::TexelDescriptor;
 
-    auto device_data = this;
-
     if (dst_type == VK_DESCRIPTOR_TYPE_SAMPLER) {
         auto dst_iter = dst_set->FindDescriptor(update->dstBinding, update->dstArrayElement);
         for (uint32_t di = 0; di < update->descriptorCount; ++di, ++dst_iter) {
@@ -2720,7 +2762,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 if (src_iter.updated()) {
                     if (!src_iter->IsImmutableSampler()) {
                         auto update_sampler = static_cast<const SamplerDescriptor &>(*src_iter).GetSampler();
-                        if (!ValidateSampler(update_sampler)) {
+                        if (!ValidateSampler(update_sampler, state_cache)) {
                             *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00325";
                             std::stringstream error_str;
                             error_str << "Attempted copy update to sampler descriptor with invalid sampler: "
@@ -2743,7 +2785,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 // First validate sampler
                 if (!img_samp_desc.IsImmutableSampler()) {
                     auto update_sampler = img_samp_desc.GetSampler();
-                    if (!ValidateSampler(update_sampler)) {
+                    if (!ValidateSampler(update_sampler, state_cache)) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00325";
                         std::stringstream error_str;
                         error_str << "Attempted copy update to sampler descriptor with invalid sampler: "
@@ -2758,7 +2800,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 auto image_view = img_samp_desc.GetImageView();
                 auto image_layout = img_samp_desc.GetImageLayout();
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, src_type, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(image_view, image_layout, src_type, state_cache, func_name, error_code, error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted copy update to combined image sampler descriptor failed due to: "
                                   << error_msg->c_str();
@@ -2777,7 +2819,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 auto image_view = img_desc.GetImageView();
                 auto image_layout = img_desc.GetImageLayout();
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, src_type, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(image_view, image_layout, src_type, state_cache, func_name, error_code, error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted copy update to image descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -2793,7 +2835,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                 if (!src_iter.updated()) continue;
                 auto buffer_view = static_cast<const TexelDescriptor &>(*src_iter).GetBufferView();
                 if (buffer_view) {
-                    auto bv_state = device_data->Get<BUFFER_VIEW_STATE>(buffer_view);
+                    auto bv_state = state_cache->GetBufferView(buffer_view);
                     if (!bv_state) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-02994";
                         std::stringstream error_str;
@@ -2803,7 +2845,7 @@ bool CoreChecks::VerifyCopyUpdateContents(const VkCopyDescriptorSet *update, con
                         return false;
                     }
                     auto buffer = bv_state->create_info.buffer;
-                    auto buffer_state = Get<BUFFER_STATE>(buffer);
+                    auto buffer_state = state_cache->GetBuffer(buffer);
                     if (!ValidateBufferUsage(report_data, buffer_state.get(), src_type, error_code, error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted copy update to texel buffer descriptor failed due to: " << error_msg->c_str();
@@ -2927,8 +2969,9 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
 
 // Validate the state for a given write update but don't actually perform the update
 //  If an error would occur for this update, return false and fill in details in error_msg string
-bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update, const char *func_name,
-                                     std::string *error_code, std::string *error_msg, bool push) const {
+bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update,
+                                     UpdateStateCache *state_cache, const char *func_name, std::string *error_code,
+                                     std::string *error_msg, bool push) const {
     const auto *dest_layout = dest_set->GetLayout().get();
 
     // Verify dst layout still valid
@@ -3098,7 +3141,7 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
     }
     auto start_idx = dest_set->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
     // Update is within bounds and consistent so last step is to validate update contents
-    if (!VerifyWriteUpdateContents(dest_set, update, start_idx, func_name, error_code, error_msg, push)) {
+    if (!VerifyWriteUpdateContents(dest_set, update, start_idx, state_cache, func_name, error_code, error_msg, push)) {
         std::stringstream error_str;
         error_str << "Write update to " << dest_set->StringifySetAndLayout() << " binding #" << update->dstBinding
                   << " failed with error message: " << error_msg->c_str();
@@ -3123,8 +3166,8 @@ bool CoreChecks::ValidateWriteUpdate(const DescriptorSet *dest_set, const VkWrit
 
 // Verify that the contents of the update are ok, but don't perform actual update
 bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const VkWriteDescriptorSet *update, const uint32_t index,
-                                           const char *func_name, std::string *error_code, std::string *error_msg,
-                                           bool push) const {
+                                           UpdateStateCache *state_cache, const char *func_name, std::string *error_code,
+                                           std::string *error_msg, bool push) const {
     using ImageSamplerDescriptor = cvdescriptorset::ImageSamplerDescriptor;
 
     switch (update->descriptorType) {
@@ -3135,11 +3178,12 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                 auto image_view = update->pImageInfo[di].imageView;
                 auto image_layout = update->pImageInfo[di].imageLayout;
                 auto sampler = update->pImageInfo[di].sampler;
-                auto iv_state = Get<IMAGE_VIEW_STATE>(image_view);
+                auto iv_state = state_cache->GetImageView(image_view);
                 const ImageSamplerDescriptor &desc = (const ImageSamplerDescriptor &)*iter;
                 if (image_view) {
                     const auto *image_state = iv_state->image_state.get();
-                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, state_cache, func_name, error_code,
+                                             error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to combined image sampler descriptor failed due to: "
                                   << error_msg->c_str();
@@ -3148,7 +3192,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                     }
                     if (IsExtEnabled(device_extensions.vk_khr_sampler_ycbcr_conversion)) {
                         if (desc.IsImmutableSampler()) {
-                            auto sampler_state = Get<SAMPLER_STATE>(desc.GetSampler());
+                            auto sampler_state = state_cache->GetSampler(desc.GetSampler());
                             if (iv_state && sampler_state) {
                                 if (iv_state->samplerConversion != sampler_state->samplerConversion) {
                                     *error_code = "VUID-VkWriteDescriptorSet-descriptorType-01948";
@@ -3204,7 +3248,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                     }
 
                     // Verify portability
-                    auto sampler_state = Get<SAMPLER_STATE>(sampler);
+                    auto sampler_state = state_cache->GetSampler(sampler);
                     if (sampler_state) {
                         if (IsExtEnabled(device_extensions.vk_khr_portability_subset)) {
                             if ((VK_FALSE == enabled_features.portability_subset_features.mutableComparisonSamplers) &&
@@ -3223,7 +3267,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
             for (uint32_t di = 0; di < update->descriptorCount && !iter.AtEnd(); ++di, ++iter) {
                 const auto &desc = *iter;
                 if (!desc.IsImmutableSampler()) {
-                    if (!ValidateSampler(update->pImageInfo[di].sampler)) {
+                    if (!ValidateSampler(update->pImageInfo[di].sampler, state_cache)) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-00325";
                         std::stringstream error_str;
                         error_str << "Attempted write update to sampler descriptor with invalid sampler: "
@@ -3248,7 +3292,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                 auto image_view = update->pImageInfo[di].imageView;
                 auto image_layout = update->pImageInfo[di].imageLayout;
                 if (image_view) {
-                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateImageUpdate(image_view, image_layout, update->descriptorType, state_cache, func_name, error_code,
+                                             error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to image descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -3263,7 +3308,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 auto buffer_view = update->pTexelBufferView[di];
                 if (buffer_view) {
-                    auto bv_state = Get<BUFFER_VIEW_STATE>(buffer_view);
+                    auto bv_state = state_cache->GetBufferView(buffer_view);
                     if (!bv_state) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-02994";
                         std::stringstream error_str;
@@ -3273,7 +3318,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
                         return false;
                     }
                     auto buffer = bv_state->create_info.buffer;
-                    auto buffer_state = Get<BUFFER_STATE>(buffer);
+                    auto buffer_state = state_cache->GetBuffer(buffer);
                     // Verify that buffer underlying the view hasn't been destroyed prematurely
                     if (!buffer_state) {
                         *error_code = "VUID-VkWriteDescriptorSet-descriptorType-02994";
@@ -3299,7 +3344,8 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
                 if (update->pBufferInfo[di].buffer) {
-                    if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, func_name, error_code, error_msg)) {
+                    if (!ValidateBufferUpdate(update->pBufferInfo + di, update->descriptorType, state_cache, func_name, error_code,
+                                              error_msg)) {
                         std::stringstream error_str;
                         error_str << "Attempted write update to buffer descriptor failed due to: " << error_msg->c_str();
                         *error_msg = error_str.str();
@@ -3314,7 +3360,7 @@ bool CoreChecks::VerifyWriteUpdateContents(const DescriptorSet *dest_set, const
         case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
             const auto *acc_info = LvlFindInChain<VkWriteDescriptorSetAccelerationStructureNV>(update->pNext);
             for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-                auto as_state = Get<ACCELERATION_STRUCTURE_STATE>(acc_info->pAccelerationStructures[di]);
+                auto as_state = state_cache->GetAccelerationStructureNV(acc_info->pAccelerationStructures[di]);
                 if (!ValidateAccelerationStructureUpdate(as_state.get(), func_name, error_code, error_msg)) {
                     std::stringstream error_str;
                     error_str << "Attempted write update to acceleration structure descriptor failed due to: "
@@ -26,6 +26,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -76,7 +79,9 @@ public:
         int64_t count;
     };
 
-    ObjectUseData() : thread(0), writer_reader_count(0) {
+    static const uint32_t kNoPoolIndex = 0xFFFFFFFF;
+
+    ObjectUseData() : thread(0), writer_reader_count(0), waiters(0), generation(0), pool_index(kNoPoolIndex), next_free(0) {
         // silence -Wunused-private-field warning
         padding[0] = 0;
     }
@@ -91,32 +96,295 @@ public:
     }
     WriteReadCount RemoveWriter() {
         int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
+        NotifyWaiters();
         return WriteReadCount(prev);
     }
     WriteReadCount RemoveReader() {
         int64_t prev = writer_reader_count.fetch_add(-1LL);
+        NotifyWaiters();
         return WriteReadCount(prev);
     }
     WriteReadCount GetCount() {
         return WriteReadCount(writer_reader_count);
     }
+    void Reset() {
+        thread = 0;
+        writer_reader_count = 0;
+    }
+    // Called when the object is destroyed, before the entry is recycled
+    void Retired() {
+        generation.fetch_add(1);
+        NotifyWaiters();
+    }
 
     void WaitForObjectIdle(bool is_writer)  {
         // Wait for thread-safe access to object instead of skipping call.
-        while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
-            std::this_thread::sleep_for(std::chrono::microseconds(1));
+        // The waiter count is raised before the counts are checked under the slot lock, and the Remove* calls check it after
+        // updating the counts, so either the waiter sees the final count or the last Remove* sees the waiter.
+        // A destroy of the object (which retires this entry) also ends the wait, so a recycled entry can't hold it.
+        const uint32_t wait_generation = generation.load();
+        waiters.fetch_add(1);
+        {
+            WaitSlot &slot = GetWaitSlot(this);
+            std::unique_lock<std::mutex> lock(slot.mutex);
+            slot.cond.wait(lock, [this, is_writer, wait_generation]() {
+                if (generation.load() != wait_generation) return true;
+                const WriteReadCount count = GetCount();
+                return count.GetReadCount() <= (int)(!is_writer) && count.GetWriteCount() <= (int)is_writer;
+            });
         }
+        waiters.fetch_sub(1);
     }
 
     std::atomic<loader_platform_thread_id> thread;
 
 private:
+    // Waiting threads block on one of a small set of condition variables shared by all objects, keyed by address, so that
+    // an ObjectUseData doesn't carry a mutex and condition variable of its own.
+    struct WaitSlot {
+        std::mutex mutex;
+        std::condition_variable cond;
+    };
+    static WaitSlot &GetWaitSlot(const ObjectUseData *use_data) {
+        static WaitSlot slots[64];
+        return slots[(reinterpret_cast<uintptr_t>(use_data) / 64) % 64];
+    }
+
+    void NotifyWaiters() {
+        // Conflicts are rare, so Remove* only pays for a load of the waiter count unless a thread is actually waiting.
+        if (waiters.load() == 0) {
+            return;
+        }
+        WaitSlot &slot = GetWaitSlot(this);
+        {
+            // Taking the slot lock orders this notify after a waiter's check of the counts, avoiding a lost wakeup.
+            std::lock_guard<std::mutex> lock(slot.mutex);
+        }
+        slot.cond.notify_all();
+    }
+
     // need to update write and read counts atomically. Writer in high
     // 32 bits, reader in low 32 bits.
     std::atomic<int64_t> writer_reader_count;
+    std::atomic<int32_t> waiters;
+    std::atomic<uint32_t> generation;
+
+    // Owned by ObjectUseDataPool
+    friend class ObjectUseDataPool;
+    uint32_t pool_index;
+    std::atomic<uint32_t> next_free;
 
     // Put each lock on its own cache line to avoid false cache line sharing.
-    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>))) & 63];
+    char padding[(-int(sizeof(std::atomic<loader_platform_thread_id>) + sizeof(std::atomic<int64_t>) +
+                       sizeof(std::atomic<int32_t>) + sizeof(std::atomic<uint32_t>) + sizeof(uint32_t) +
+                       sizeof(std::atomic<uint32_t>))) & 63];
+};
+
+// Address stable storage for the ObjectUseData of a counter. Entries are allocated from slabs that live as long as the
+// counter, so the object table can hold plain pointers and lookups don't copy (and atomically reference count) a shared_ptr.
+//
+// Destroyed entries are reclaimed with epochs. A thread holds a UseScope from its object table lookup until it is done with
+// the entry, and each open scope is counted against the epoch it started in. The epoch only advances once no scope of the
+// epoch before it is still open, and a retired entry waits in a limbo list until the epoch has advanced twice. By then no
+// scope that could have found the entry in the table is left, so a use racing a destroy (itself an application threading
+// error) can't touch the counts of an unrelated new object, and Reset() can't race it either.
+// Reclaimed entries go onto a lock-free free list whose head carries a tag against ABA. Scopes are counted in per-thread
+// stripes, so uses of different objects from different threads don't contend on one cache line. Entries beyond what the
+// slabs address are kept in a mutex guarded overflow list and recycled the same way.
+class ObjectUseDataPool
+{
+public:
+    class UseScope {
+    public:
+        UseScope(ObjectUseDataPool &pool) : active_(pool.EnterScope()) {}
+        ~UseScope() { active_->fetch_sub(1); }
+
+    private:
+        std::atomic<int32_t> *active_;
+    };
+
+    ObjectUseDataPool() : free_head_(MakeHead(kNoIndex, 0)), next_index_(0), epoch_(0), advancing_(false) {
+        for (auto &slab : slabs_) {
+            slab.store(nullptr, std::memory_order_relaxed);
+        }
+        for (auto &limbo : limbo_) {
+            limbo.store(kNoIndex, std::memory_order_relaxed);
+        }
+    }
+    ~ObjectUseDataPool() {
+        for (auto &slab : slabs_) {
+            delete[] slab.load(std::memory_order_relaxed);
+        }
+    }
+
+    ObjectUseData *Allocate() {
+        ObjectUseData *use_data = PopFree();
+        if (!use_data) {
+            TryAdvanceEpoch();
+            use_data = PopFree();
+        }
+        if (!use_data) {
+            use_data = AllocateNew();
+        }
+        use_data->Reset();
+        return use_data;
+    }
+
+    void Retire(ObjectUseData *use_data) {
+        use_data->Retired();
+        if (use_data->pool_index == kNoIndex) {
+            std::lock_guard<std::mutex> lock(overflow_mutex_);
+            overflow_retired_.emplace_back(use_data, epoch_.load());
+            return;
+        }
+        // Only whole lists are ever taken off a limbo list, so a plain push is safe from ABA
+        std::atomic<uint32_t> &limbo = limbo_[epoch_.load() % 3];
+        uint32_t head = limbo.load();
+        do {
+            use_data->next_free.store(head, std::memory_order_relaxed);
+        } while (!limbo.compare_exchange_weak(head, use_data->pool_index));
+    }
+
+private:
+    static const uint32_t kSlabSize = 1024;
+    static const uint32_t kMaxSlabs = 1024;
+    static const uint32_t kStripes = 8;
+    static const uint32_t kNoIndex = ObjectUseData::kNoPoolIndex;
+
+    struct ActiveCount {
+        ActiveCount() : count(0) {
+            // silence -Wunused-private-field warning
+            padding[0] = 0;
+        }
+        std::atomic<int32_t> count;
+        // Each stripe on its own cache line
+        char padding[64 - sizeof(std::atomic<int32_t>)];
+    };
+
+    static uint64_t MakeHead(uint32_t index, uint32_t tag) { return (static_cast<uint64_t>(tag) << 32) | index; }
+    static uint32_t HeadIndex(uint64_t head) { return static_cast<uint32_t>(head & 0xFFFFFFFF); }
+    static uint32_t HeadTag(uint64_t head) { return static_cast<uint32_t>(head >> 32); }
+    ObjectUseData *GetEntry(uint32_t index) const {
+        return &slabs_[index / kSlabSize].load(std::memory_order_acquire)[index % kSlabSize];
+    }
+    static uint32_t GetStripe() {
+        static std::atomic<uint32_t> next_stripe(0);
+        static thread_local uint32_t stripe = next_stripe.fetch_add(1) % kStripes;
+        return stripe;
+    }
+
+    std::atomic<int32_t> *EnterScope() {
+        const uint32_t stripe = GetStripe();
+        for (;;) {
+            const uint64_t epoch = epoch_.load();
+            std::atomic<int32_t> &active = active_[epoch & 1][stripe].count;
+            active.fetch_add(1);
+            // If the epoch moved on meanwhile, the advance may not have seen this scope
+            if (epoch_.load() == epoch) {
+                return &active;
+            }
+            active.fetch_sub(1);
+        }
+    }
+
+    void TryAdvanceEpoch() {
+        // Advancing is left to whichever thread gets here first, nobody waits for it
+        if (advancing_.exchange(true)) {
+            return;
+        }
+        const uint64_t epoch = epoch_.load();
+        bool idle = true;
+        for (const auto &active : active_[(epoch + 1) & 1]) {
+            if (active.count.load() != 0) {
+                idle = false;
+                break;
+            }
+        }
+        if (idle) {
+            epoch_.store(epoch + 1);
+            // Entries retired two epochs before the new one can no longer be held by any open scope
+            PushFree(limbo_[(epoch + 2) % 3].exchange(kNoIndex));
+        }
+        advancing_.store(false);
+    }
+
+    ObjectUseData *PopFree() {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        while (HeadIndex(head) != kNoIndex) {
+            ObjectUseData *use_data = GetEntry(HeadIndex(head));
+            const uint64_t next = MakeHead(use_data->next_free.load(std::memory_order_relaxed), HeadTag(head) + 1);
+            if (free_head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return use_data;
+            }
+        }
+        return nullptr;
+    }
+
+    // Pushes a list linked through next_free onto the free list
+    void PushFree(uint32_t first) {
+        if (first == kNoIndex) {
+            return;
+        }
+        ObjectUseData *last = GetEntry(first);
+        for (uint32_t index = last->next_free.load(std::memory_order_relaxed); index != kNoIndex;
+             index = last->next_free.load(std::memory_order_relaxed)) {
+            last = GetEntry(index);
+        }
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        uint64_t next;
+        do {
+            last->next_free.store(HeadIndex(head), std::memory_order_relaxed);
+            next = MakeHead(first, HeadTag(head) + 1);
+        } while (!free_head_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    ObjectUseData *AllocateNew() {
+        uint32_t index = next_index_.load(std::memory_order_relaxed);
+        do {
+            if (index >= kSlabSize * kMaxSlabs) {
+                return AllocateOverflow();
+            }
+        } while (!next_index_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+
+        const uint32_t slab_index = index / kSlabSize;
+        ObjectUseData *slab = slabs_[slab_index].load(std::memory_order_acquire);
+        if (!slab) {
+            ObjectUseData *new_slab = new ObjectUseData[kSlabSize];
+            for (uint32_t i = 0; i < kSlabSize; ++i) {
+                new_slab[i].pool_index = slab_index * kSlabSize + i;
+            }
+            if (slabs_[slab_index].compare_exchange_strong(slab, new_slab, std::memory_order_acq_rel)) {
+                slab = new_slab;
+            } else {
+                delete[] new_slab;
+            }
+        }
+        return &slab[index % kSlabSize];
+    }
+
+    // More live objects of one type than the slabs can address
+    ObjectUseData *AllocateOverflow() {
+        std::lock_guard<std::mutex> lock(overflow_mutex_);
+        if (!overflow_retired_.empty() && overflow_retired_.front().second + 2 <= epoch_.load()) {
+            ObjectUseData *use_data = overflow_retired_.front().first;
+            overflow_retired_.pop_front();
+            return use_data;
+        }
+        overflow_.emplace_back(new ObjectUseData);
+        return overflow_.back().get();
+    }
+
+    std::atomic<uint64_t> free_head_;
+    std::atomic<uint32_t> next_index_;
+    std::atomic<ObjectUseData *> slabs_[kMaxSlabs];
+    std::atomic<uint64_t> epoch_;
+    std::atomic<bool> advancing_;
+    ActiveCount active_[2][kStripes];
+    // Retired entries by epoch modulo 3, linked through next_free
+    std::atomic<uint32_t> limbo_[3];
+    std::mutex overflow_mutex_;
+    std::vector<std::unique_ptr<ObjectUseData>> overflow_;
+    std::deque<std::pair<ObjectUseData *, uint64_t>> overflow_retired_;
 };
 
 
@@ -127,23 +395,30 @@ public:
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    ObjectUseDataPool use_data_pool;
+    vl_concurrent_unordered_map<T, ObjectUseData *, 6> object_table;
 
     void CreateObject(T object) {
-        object_table.insert(object, std::make_shared<ObjectUseData>());
+        ObjectUseData *use_data = use_data_pool.Allocate();
+        if (!object_table.insert(object, use_data)) {
+            use_data_pool.Retire(use_data);
+        }
     }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(object);
+            if (iter != object_table.end()) {
+                use_data_pool.Retire(iter->second);
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object) {
+    ObjectUseData *FindObject(T object) {
         assert(object_table.contains(object));
-        auto iter = std::move(object_table.find(object));
+        auto iter = object_table.find(object);
         if (iter != object_table.end()) {
-            return std::move(iter->second);
+            return iter->second;
         } else {
             object_data->LogError(object, kVUID_Threading_Info,
                     "Couldn't find %s Object 0x%" PRIxLEAST64
@@ -157,6 +432,7 @@ public:
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        ObjectUseDataPool::UseScope scope(use_data_pool);
         bool skip = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
 
@@ -219,6 +495,7 @@ public:
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        ObjectUseDataPool::UseScope scope(use_data_pool);
         // Object is no longer in use
         auto use_data = FindObject(object);
         if (!use_data) {
@@ -231,6 +508,7 @@ public:
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        ObjectUseDataPool::UseScope scope(use_data_pool);
         bool skip = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
 
@@ -262,6 +540,7 @@ public:
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        ObjectUseDataPool::UseScope scope(use_data_pool);
 
         auto use_data = FindObject(object);
         if (!use_data) {
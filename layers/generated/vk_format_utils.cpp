@@ -28,7 +28,10 @@
 
 #include "vk_format_utils.h"
 #include "vk_layer_utils.h"
+#include <algorithm>
+#include <initializer_list>
 #include <map>
+#include <utility>
 #include <vector>
 
 
@@ -63,17 +66,88 @@ struct FORMAT_INFO {
     COMPONENT_INFO components[FORMAT_MAX_COMPONENTS];
 };
 
-namespace std {
-template <>
-struct hash<VkFormat> {
-    size_t operator()(VkFormat fmt) const NOEXCEPT {
-        return hash<uint32_t>()(static_cast<uint32_t>(fmt));
+static const uint32_t kFormatTableExtensionBase = 1000000000;
+static const uint32_t kFormatTableNoSlot = 0xFFFFFFFF;
+static const uint16_t kFormatTableNoRow = 0xFFFF;
+
+// Dense lookup from VkFormat to per-format data, built once from the generated rows.
+// Core formats are indexed directly by value. Extension formats are assigned as 1000000000 + 1000 * (extension - 1) + offset,
+// so each extension contributes one short block of slots packed after the core ones. A lookup is one range check (plus a walk
+// over the handful of extension blocks for extension formats) and two indexed loads, with no hashing.
+template <typename T>
+class FormatTable {
+  public:
+    FormatTable(std::initializer_list<std::pair<VkFormat, T>> entries) {
+        // First pass sizes the core range and each extension block
+        for (const auto &entry : entries) {
+            const uint32_t value = static_cast<uint32_t>(entry.first);
+            if (value < kFormatTableExtensionBase) {
+                core_count_ = std::max(core_count_, value + 1);
+                continue;
+            }
+            const uint32_t extension = (value - kFormatTableExtensionBase) / 1000;
+            auto block = std::find_if(blocks_.begin(), blocks_.end(),
+                                      [extension](const ExtensionBlock &b) { return b.extension == extension; });
+            if (block == blocks_.end()) {
+                blocks_.push_back({extension, value, value, 0});
+            } else {
+                block->first = std::min(block->first, value);
+                block->last = std::max(block->last, value);
+            }
+        }
+        uint32_t slot_count = core_count_;
+        for (auto &block : blocks_) {
+            block.slot_base = slot_count;
+            slot_count += block.last - block.first + 1;
+        }
+
+        slot_to_row_.assign(slot_count, kFormatTableNoRow);
+        rows_.reserve(entries.size());
+        for (const auto &entry : entries) {
+            slot_to_row_[Slot(entry.first)] = static_cast<uint16_t>(rows_.size());
+            rows_.push_back(entry.second);
+        }
     }
+
+    // Returns nullptr if the format has no row
+    const T *find(VkFormat format) const {
+        const uint32_t slot = Slot(format);
+        if (slot == kFormatTableNoSlot) {
+            return nullptr;
+        }
+        const uint16_t row = slot_to_row_[slot];
+        return (row == kFormatTableNoRow) ? nullptr : &rows_[row];
+    }
+
+  private:
+    struct ExtensionBlock {
+        uint32_t extension;
+        uint32_t first;
+        uint32_t last;
+        uint32_t slot_base;
+    };
+
+    uint32_t Slot(VkFormat format) const {
+        const uint32_t value = static_cast<uint32_t>(format);
+        if (value < core_count_) {
+            return value;
+        }
+        for (const auto &block : blocks_) {
+            if ((value >= block.first) && (value <= block.last)) {
+                return block.slot_base + (value - block.first);
+            }
+        }
+        return kFormatTableNoSlot;
+    }
+
+    uint32_t core_count_ = 0;
+    std::vector<ExtensionBlock> blocks_;
+    std::vector<uint16_t> slot_to_row_;
+    std::vector<T> rows_;
 };
-}
 
 // clang-format off
-static const layer_data::unordered_map<VkFormat, FORMAT_INFO> kVkFormatTable = {
+static const FormatTable<FORMAT_INFO> kVkFormatTable = {
     {VK_FORMAT_A1R5G5B5_UNORM_PACK16,
         {FORMAT_COMPATIBILITY_CLASS::_16BIT, 2, 1, {1, 1, 1}, 4,
         {{COMPONENT_TYPE::A, 1}, {COMPONENT_TYPE::R, 5}, {COMPONENT_TYPE::G, 5}, {COMPONENT_TYPE::B, 5}} }},
@@ -835,7 +909,7 @@ struct MULTIPLANE_COMPATIBILITY {
 
 // Source: Vulkan spec Table 47. Plane Format Compatibility Table
 // clang-format off
-static const layer_data::unordered_map<VkFormat, MULTIPLANE_COMPATIBILITY> kVkMultiplaneCompatibilityMap {
+static const FormatTable<MULTIPLANE_COMPATIBILITY> kVkMultiplaneCompatibilityMap {
     { VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16, {{
         { 1, 1, VK_FORMAT_R10X6_UNORM_PACK16 },
         { 2, 2, VK_FORMAT_R10X6G10X6_UNORM_2PACK16 }
@@ -1812,49 +1886,49 @@ uint32_t FormatPlaneCount(VkFormat format) {
 // Will return VK_FORMAT_UNDEFINED if given a plane aspect that doesn't exist for the format
 VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     const uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= FORMAT_MAX_PLANES)) {
+    const MULTIPLANE_COMPATIBILITY *it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
+    if ((it == nullptr) || (plane_idx >= FORMAT_MAX_PLANES)) {
         return VK_FORMAT_UNDEFINED;
     }
 
-    return it->second.per_plane[plane_idx].compatible_format;
+    return it->per_plane[plane_idx].compatible_format;
 }
 
 // Will return {1, 1} if given a plane aspect that doesn't exist for the format
 VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     VkExtent2D divisors = {1, 1};
     const uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= FORMAT_MAX_PLANES)) {
+    const MULTIPLANE_COMPATIBILITY *it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
+    if ((it == nullptr) || (plane_idx >= FORMAT_MAX_PLANES)) {
         return divisors;
     }
 
-    divisors.width = it->second.per_plane[plane_idx].width_divisor;
-    divisors.height = it->second.per_plane[plane_idx].height_divisor;
+    divisors.width = it->per_plane[plane_idx].width_divisor;
+    divisors.height = it->per_plane[plane_idx].height_divisor;
     return divisors;
 }
 
 
 uint32_t FormatComponentCount(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.component_count;
+    const FORMAT_INFO *format_info = kVkFormatTable.find(format);
+    if (format_info != nullptr) {
+        return format_info->component_count;
     }
     return 0;
 }
 
 VkExtent3D FormatTexelBlockExtent(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.block_extent;
+    const FORMAT_INFO *format_info = kVkFormatTable.find(format);
+    if (format_info != nullptr) {
+        return format_info->block_extent;
     }
     return {1, 1, 1};
 }
 
 FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.compatibility;
+    const FORMAT_INFO *format_info = kVkFormatTable.find(format);
+    if (format_info != nullptr) {
+        return format_info->compatibility;
     }
     return FORMAT_COMPATIBILITY_CLASS::NONE;
 }
@@ -1882,9 +1956,9 @@ uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags aspectMask) {
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.block_size;
+    const FORMAT_INFO *item = kVkFormatTable.find(format);
+    if (item != nullptr) {
+        return item->block_size;
     }
     return 0;
 }
@@ -94,6 +94,38 @@ ImageSubresourceLayoutMap::ImageSubresourceLayoutMap(const IMAGE_STATE& image_st
       layouts_(encoder_.SubresourceCount()),
       initial_layout_states_() {}
 
+bool ImageSubresourceLayoutMap::IsWholeImage(const VkImageSubresourceRange& range) const {
+    const auto& limits = encoder_.Limits();
+    return (range.baseMipLevel == 0) && (range.levelCount == limits.mipLevel) && (range.baseArrayLayer == 0) &&
+           (range.layerCount == limits.arrayLayer) && ((range.aspectMask & limits.aspectMask) == limits.aspectMask);
+}
+
+// Most images are only ever transitioned as a whole, leaving the map empty or holding a single entry that covers every
+// subresource. Whole image updates of such a map are done in place, without generating ranges or searching the map. Returns
+// false if the map has been split by a partial update, and the caller has to take the general path.
+bool ImageSubresourceLayoutMap::UpdateWholeImage(LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state,
+                                                 const IMAGE_VIEW_STATE* view_state, bool* updated) {
+    const IndexRange whole_image(0, encoder_.SubresourceCount());
+    if (layouts_.empty()) {
+        if (new_entry.state == nullptr) {
+            initial_layout_states_.emplace_back(cb_state, view_state);
+            new_entry.state = &initial_layout_states_.back();
+        }
+        layouts_.insert(layouts_.end(), std::make_pair(whole_image, new_entry));
+        *updated = true;
+        return true;
+    }
+    if (layouts_.size() == 1) {
+        auto& only_entry = *layouts_.begin();
+        if (only_entry.first == whole_image) {
+            // Same rule as UpdateLayoutStateImpl, existing entries are only touched if their current layout changes
+            *updated = only_entry.second.CurrentWillChange(new_entry.current_layout) && only_entry.second.Update(new_entry);
+            return true;
+        }
+    }
+    return false;
+}
+
 // Use the unwrapped maps from the BothMap in the actual implementation
 template <typename LayoutMap>
 static bool SetSubresourceRangeLayoutImpl(LayoutMap& layouts, InitialLayoutStates& initial_layout_states, RangeGenerator& range_gen,
@@ -114,6 +146,14 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
+    if (IsWholeImage(range)) {
+        LayoutEntry entry(expected_layout, layout);
+        bool updated = false;
+        if (UpdateWholeImage(entry, cb_state, nullptr, &updated)) {
+            return updated;
+        }
+    }
+
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -141,6 +181,14 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
+    if (IsWholeImage(range)) {
+        LayoutEntry entry(layout);
+        bool updated = false;
+        if (UpdateWholeImage(entry, cb_state, nullptr, &updated)) {
+            return;
+        }
+    }
+
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
@@ -153,6 +201,14 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                                                  const IMAGE_VIEW_STATE& view_state) {
+    if (IsWholeImage(view_state.normalized_subresource_range)) {
+        LayoutEntry entry(layout);
+        bool updated = false;
+        if (UpdateWholeImage(entry, cb_state, &view_state, &updated)) {
+            return;
+        }
+    }
+
     RangeGenerator range_gen(view_state.range_generator);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
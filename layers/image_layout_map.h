@@ -22,6 +22,7 @@
 #ifndef IMAGE_LAYOUT_MAP_H_
 #define IMAGE_LAYOUT_MAP_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -40,6 +41,7 @@ class IMAGE_VIEW_STATE;
 
 namespace image_layout_map {
 const static VkImageLayout kInvalidLayout = VK_IMAGE_LAYOUT_MAX_ENUM;
+const static uint64_t kNoGlobalLayoutVersion = ~0ULL;
 
 // Common types for this namespace
 using IndexType = subresource_adapter::IndexType;
@@ -165,18 +167,41 @@ class ImageSubresourceLayoutMap {
         return false;
     }
 
+    // Submit time bookkeeping, in terms of versions of the image's global layout map (GlobalImageLayoutRangeMap::GetVersion()).
+    // If the map was found valid against, or was spliced into, the global map in its current version, a resubmission of the
+    // unchanged command buffer can skip that step.
+    bool ValidatedAgainst(uint64_t global_version) const {
+        return validated_global_version_.load(std::memory_order_relaxed) == global_version;
+    }
+    void SetValidatedAgainst(uint64_t global_version) const {
+        validated_global_version_.store(global_version, std::memory_order_relaxed);
+    }
+    bool SplicedInto(uint64_t global_version) const {
+        return spliced_global_version_.load(std::memory_order_relaxed) == global_version;
+    }
+    void SetSplicedInto(uint64_t global_version) const {
+        spliced_global_version_.store(global_version, std::memory_order_relaxed);
+    }
+
   protected:
     inline uint32_t LevelLimit(uint32_t level) const { return std::min(encoder_.Limits().mipLevel, level); }
     inline uint32_t LayerLimit(uint32_t layer) const { return std::min(encoder_.Limits().arrayLayer, layer); }
 
     bool InRange(const VkImageSubresource& subres) const { return encoder_.InRange(subres); }
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
+    bool IsWholeImage(const VkImageSubresourceRange& range) const;
 
   private:
+    bool UpdateWholeImage(LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state, const IMAGE_VIEW_STATE* view_state,
+                          bool* updated);
+
     const IMAGE_STATE& image_state_;
     const Encoder& encoder_;
     LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+    // Atomic, as a command buffer with VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT can be submitted on several queues at once
+    mutable std::atomic<uint64_t> validated_global_version_{kNoGlobalLayoutVersion};
+    mutable std::atomic<uint64_t> spliced_global_version_{kNoGlobalLayoutVersion};
 };
 }  // namespace image_layout_map
 #endif
@@ -29,6 +29,7 @@
 #include "pipeline_state.h"
 #include "descriptor_sets.h"
 #include "state_tracker.h"
+#include <atomic>
 #include <limits>
 
 static VkImageSubresourceRange MakeImageFullRange(const VkImageCreateInfo &create_info) {
@@ -339,6 +340,11 @@ bool IMAGE_STATE::IsCompatibleAliasing(IMAGE_STATE *other_image_state) const {
     return false;
 }
 
+uint64_t GlobalImageLayoutRangeMap::NextVersion() {
+    static std::atomic<uint64_t> next_version{0};
+    return next_version.fetch_add(1, std::memory_order_relaxed);
+}
+
 void IMAGE_STATE::SetInitialLayoutMap() {
     if (layout_range_map) {
         return;
@@ -512,6 +518,61 @@ void IMAGE_VIEW_STATE::Destroy() {
 
 bool IMAGE_VIEW_STATE::IsDepthSliced() const { return ::IsDepthSliced(image_state->createInfo, create_info); }
 
+std::shared_ptr<const subresource_adapter::RangeListGenerator::RangeList> IMAGE_VIEW_STATE::GetFragmentRanges(
+    bool is_depth_sliced) const {
+    const auto *encoder = image_state->fragment_encoder.get();
+    if (!encoder) {
+        // Nothing is memoized, so the ranges are built once the image is bound
+        return std::make_shared<const subresource_adapter::RangeListGenerator::RangeList>();
+    }
+    // Views require a bound image, so the fragment encoder doesn't change once it exists
+    const size_t index = is_depth_sliced ? 1 : 0;
+    std::call_once(fragment_ranges_once_[index], [this, encoder, is_depth_sliced, index]() {
+        fragment_ranges_[index] = encoder->GetRanges(normalized_subresource_range, is_depth_sliced);
+    });
+    return fragment_ranges_[index];
+}
+
+std::shared_ptr<const IMAGE_VIEW_STATE::AttachmentRanges> IMAGE_VIEW_STATE::GetAttachmentRanges(VkImageAspectFlags aspect_mask,
+                                                                                                const VkOffset3D &offset,
+                                                                                                const VkExtent3D &extent,
+                                                                                                VkDeviceSize base_address) const {
+    const auto *encoder = image_state->fragment_encoder.get();
+    if (!encoder) return nullptr;
+    auto find_entry = [this, aspect_mask, &offset, &extent, base_address]() -> std::shared_ptr<const AttachmentRanges> {
+        for (const auto &entry : attachment_ranges_) {
+            if ((entry.aspect_mask == aspect_mask) && (entry.base_address == base_address) && (entry.offset.x == offset.x) &&
+                (entry.offset.y == offset.y) && (entry.offset.z == offset.z) && (entry.extent.width == extent.width) &&
+                (entry.extent.height == extent.height) && (entry.extent.depth == extent.depth)) {
+                return entry.ranges;
+            }
+        }
+        return nullptr;
+    };
+    {
+        std::lock_guard<std::mutex> guard(attachment_ranges_lock_);
+        auto found = find_entry();
+        if (found) return found;
+    }
+
+    VkImageSubresourceRange subres_range = normalized_subresource_range;
+    subres_range.aspectMask = aspect_mask;
+    auto ranges = std::make_shared<AttachmentRanges>();
+    for (subresource_adapter::ImageRangeGenerator range_gen(*encoder, subres_range, offset, extent, base_address, IsDepthSliced());
+         range_gen->non_empty(); ++range_gen) {
+        ranges->emplace_back(*range_gen);
+    }
+
+    std::lock_guard<std::mutex> guard(attachment_ranges_lock_);
+    // Another render pass instance may have built the same list while we weren't holding the lock
+    auto found = find_entry();
+    if (found) return found;
+    if (attachment_ranges_.size() < kMaxAttachmentRanges) {
+        attachment_ranges_.emplace_back(AttachmentRangesEntry{aspect_mask, offset, extent, base_address, ranges});
+    }
+    return ranges;
+}
+
 VkOffset3D IMAGE_VIEW_STATE::GetOffset() const {
     VkOffset3D result = {0, 0, 0};
     if (IsDepthSliced()) {
@@ -27,6 +27,8 @@
  */
 #pragma once
 
+#include <array>
+#include <mutex>
 #include "device_memory_state.h"
 #include "image_layout_map.h"
 #include "vk_format_utils.h"
@@ -68,12 +70,20 @@ static inline VkImageSubresourceRange RangeFromLayers(const VkImageSubresourceLa
 
 class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkImageLayout, 16> {
   public:
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
+    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index), version_(NextVersion()) {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // Identifies the current contents of the map. Versions are unique across all maps, so that a version seen earlier
+    // can't match a different map that happens to reuse the address. Access with the lock held.
+    uint64_t GetVersion() const { return version_; }
+    void UpdateVersion() { version_ = NextVersion(); }
+
   private:
+    static uint64_t NextVersion();
+
     mutable ReadWriteLock lock_;
+    uint64_t version_;
 };
 
 // State for VkImage objects.
@@ -265,7 +275,34 @@ class IMAGE_VIEW_STATE : public BASE_NODE {
     VkExtent3D GetExtent() const;
     uint32_t GetAttachmentLayerCount() const;
 
+    // The image's fragment encoder ranges covering normalized_subresource_range, relative to the image base address.
+    // Empty if the image doesn't have a fragment encoder yet.
+    std::shared_ptr<const subresource_adapter::RangeListGenerator::RangeList> GetFragmentRanges(bool is_depth_sliced) const;
+
+    // The image's fragment encoder ranges at base_address, covering the aspect_mask aspects of the view within offset and
+    // extent. Render pass instances with the same render area share the list. Null if the image has no fragment encoder yet.
+    using AttachmentRanges = subresource_adapter::RangeListGenerator::RangeList;
+    std::shared_ptr<const AttachmentRanges> GetAttachmentRanges(VkImageAspectFlags aspect_mask, const VkOffset3D &offset,
+                                                                const VkExtent3D &extent, VkDeviceSize base_address) const;
+
     bool Invalid() const override { return Destroyed() || !image_state || image_state->Invalid(); }
+
+  private:
+    // Indexed by is_depth_sliced
+    mutable std::array<std::once_flag, 2> fragment_ranges_once_;
+    mutable std::array<std::shared_ptr<const subresource_adapter::RangeListGenerator::RangeList>, 2> fragment_ranges_;
+
+    struct AttachmentRangesEntry {
+        VkImageAspectFlags aspect_mask;
+        VkOffset3D offset;
+        VkExtent3D extent;
+        VkDeviceSize base_address;
+        std::shared_ptr<const AttachmentRanges> ranges;
+    };
+    // A view is rarely used with more than a couple of render areas, lists for any beyond these aren't memoized
+    static constexpr uint32_t kMaxAttachmentRanges = 4;
+    mutable std::mutex attachment_ranges_lock_;
+    mutable small_vector<AttachmentRangesEntry, kMaxAttachmentRanges, uint32_t> attachment_ranges_;
 };
 
 struct SWAPCHAIN_IMAGE {
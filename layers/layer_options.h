@@ -104,4 +104,5 @@ static const std::vector<std::string> EnableFlagNameHelper = {
     "VALIDATION_CHECK_ENABLE_SYNCHRONIZATION_VALIDATION_QUEUE_SUBMIT",     // queuesubmit time sync_validation,
 };
 
+const VkLayerSettingsEXT *FindSettingsInChain(const void *next);
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data);
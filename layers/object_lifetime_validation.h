@@ -52,7 +52,8 @@ struct ObjTrackState {
     VulkanObjectType object_type;                                  // Object type identifier
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
-    std::unique_ptr<layer_data::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    std::unique_ptr<layer_data::unordered_set<uint64_t> > child_objects;  // Child objects (VkDescriptorPool and VkCommandPool only)
+    std::mutex child_objects_lock;  // Guards child_objects, so pools don't serialize on the device wide object_lifetime_mutex
 };
 
 typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
@@ -145,33 +146,39 @@ class ObjectLifetimes : public ValidationObject {
         if (!object_map[object_type].contains(object_handle)) {
             // If object is an image, also look for it in the swapchain image map
             if ((object_type != kVulkanObjectTypeImage) || (swapchainImageMap.find(object_handle) == swapchainImageMap.end())) {
-                // Object not found, look for it in other device object maps
-                for (const auto &other_device_data : layer_data_map) {
-                    for (auto *layer_object_data : other_device_data.second->object_dispatch) {
-                        if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
-                            auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
-                            if (object_lifetime_data && (object_lifetime_data != this)) {
-                                if (object_lifetime_data->object_map[object_type].find(object_handle) !=
-                                        object_lifetime_data->object_map[object_type].end() ||
-                                    (object_type == kVulkanObjectTypeImage &&
-                                     object_lifetime_data->swapchainImageMap.find(object_handle) !=
-                                         object_lifetime_data->swapchainImageMap.end())) {
-                                    // Object found on other device, report an error if object has a device parent error code
-                                    if ((wrong_device_code != kVUIDUndefined) && (object_type != kVulkanObjectTypeSurfaceKHR)) {
-                                        return LogError(instance, wrong_device_code,
-                                                        "Object 0x%" PRIxLEAST64
-                                                        " of type %s"
-                                                        " was not created, allocated or retrieved from the correct device.",
-                                                        object_handle, object_string[object_type]);
-
-                                    } else {
-                                        return false;
-                                    }
+                // Object not found, look for it in other device object maps. Other threads may be creating or destroying
+                // devices, so hold the layer data map lock while walking it.
+                bool found_on_other_device = false;
+                {
+                    std::lock_guard<std::mutex> lock(LayerDataMapLock<ValidationObject>());
+                    for (const auto &other_device_data : layer_data_map) {
+                        for (auto *layer_object_data : other_device_data.second->object_dispatch) {
+                            if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
+                                auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
+                                if (object_lifetime_data && (object_lifetime_data != this) &&
+                                    (object_lifetime_data->object_map[object_type].contains(object_handle) ||
+                                     (object_type == kVulkanObjectTypeImage &&
+                                      object_lifetime_data->swapchainImageMap.find(object_handle) !=
+                                          object_lifetime_data->swapchainImageMap.end()))) {
+                                    found_on_other_device = true;
+                                    break;
                                 }
                             }
                         }
+                        if (found_on_other_device) break;
                     }
                 }
+                if (found_on_other_device) {
+                    // Object found on other device, report an error if object has a device parent error code
+                    if ((wrong_device_code != kVUIDUndefined) && (object_type != kVulkanObjectTypeSurfaceKHR)) {
+                        return LogError(instance, wrong_device_code,
+                                        "Object 0x%" PRIxLEAST64
+                                        " of type %s"
+                                        " was not created, allocated or retrieved from the correct device.",
+                                        object_handle, object_string[object_type]);
+                    }
+                    return false;
+                }
                 // Report an error if object was not found anywhere
                 return LogError(instance, invalid_handle_code, "Invalid %s Object 0x%" PRIxLEAST64 ".", object_string[object_type],
                                 object_handle);
@@ -198,22 +205,38 @@ class ObjectLifetimes : public ValidationObject {
     void CreateObject(T1 object, VulkanObjectType object_type, const VkAllocationCallbacks *pAllocator) {
         uint64_t object_handle = HandleToUint64(object);
         bool custom_allocator = (pAllocator != nullptr);
-        if (!object_map[object_type].contains(object_handle)) {
-            auto pNewObjNode = std::make_shared<ObjTrackState>();
-            pNewObjNode->object_type = object_type;
-            pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
-            pNewObjNode->handle = object_handle;
+        auto pNewObjNode = std::make_shared<ObjTrackState>();
+        pNewObjNode->object_type = object_type;
+        pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
+        pNewObjNode->handle = object_handle;
+        if ((object_type == kVulkanObjectTypeDescriptorPool) || (object_type == kVulkanObjectTypeCommandPool)) {
+            pNewObjNode->child_objects.reset(new layer_data::unordered_set<uint64_t>);
+        }
 
-            InsertObject(object_map[object_type], object, object_type, pNewObjNode);
+        // A single insert both checks for and adds the object, an already tracked object is left as is
+        if (object_map[object_type].insert(object_handle, std::move(pNewObjNode))) {
             num_objects[object_type]++;
             num_total_objects++;
-
-            if (object_type == kVulkanObjectTypeDescriptorPool) {
-                pNewObjNode->child_objects.reset(new layer_data::unordered_set<uint64_t>);
-            }
         }
     }
 
+    void RemoveObjectCount(VulkanObjectType object_type, uint64_t count = 1) {
+        assert(num_total_objects >= count);
+        num_total_objects -= count;
+        assert(num_objects[object_type] >= count);
+        num_objects[object_type] -= count;
+    }
+
+    // Destroy all child objects of a pool, with a single batched erase from the object map rather than one per child
+    void DestroyPoolChildren(ObjTrackState &pool_node, VulkanObjectType child_type) {
+        if (!pool_node.child_objects) return;
+        std::lock_guard<std::mutex> guard(pool_node.child_objects_lock);
+        if (pool_node.child_objects->empty()) return;
+        const size_t erased = object_map[child_type].erase_batch(*pool_node.child_objects);
+        RemoveObjectCount(child_type, erased);
+        pool_node.child_objects->clear();
+    }
+
     void DestroyObjectSilently(uint64_t object, VulkanObjectType object_type) {
         assert(object != HandleToUint64(VK_NULL_HANDLE));
 
@@ -228,18 +251,15 @@ class ObjectLifetimes : public ValidationObject {
 
             return;
         }
-        assert(num_total_objects > 0);
-
-        num_total_objects--;
-        assert(num_objects[item->second->object_type] > 0);
-
-        num_objects[item->second->object_type]--;
+        RemoveObjectCount(item->second->object_type);
     }
 
     template <typename T1>
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type) {
         auto object = HandleToUint64(object_handle);
         if (object != HandleToUint64(VK_NULL_HANDLE)) {
+            // Untracked objects were already reported at validation time, which doesn't necessarily skip the call. Only an
+            // object that is still tracked can have been destroyed concurrently, and DestroyObjectSilently reports that.
             if (object_map[object_type].contains(object)) {
                 DestroyObjectSilently(object, object_type);
             }
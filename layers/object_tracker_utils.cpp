@@ -97,6 +97,12 @@ void ObjectLifetimes::AllocateCommandBuffer(const VkCommandPool command_pool, co
     InsertObject(object_map[kVulkanObjectTypeCommandBuffer], command_buffer, kVulkanObjectTypeCommandBuffer, new_obj_node);
     num_objects[kVulkanObjectTypeCommandBuffer]++;
     num_total_objects++;
+
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(command_pool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end() && itr->second->child_objects) {
+        std::lock_guard<std::mutex> guard(itr->second->child_objects_lock);
+        itr->second->child_objects->insert(HandleToUint64(command_buffer));
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer) const {
@@ -454,15 +460,7 @@ bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDesc
     skip |=
         ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, false,
                        "VUID-vkResetDescriptorPool-descriptorPool-parameter", "VUID-vkResetDescriptorPool-descriptorPool-parent");
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
-    }
+    // The pool's descriptor sets have no allocator VUIDs to check, so there is no per-set validation.
     return skip;
 }
 
@@ -473,11 +471,7 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyPoolChildren(*itr->second, kVulkanObjectTypeDescriptorSet);
     }
 }
 
@@ -696,9 +690,20 @@ bool ObjectLifetimes::PreCallValidateFreeCommandBuffers(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                                       const VkCommandBuffer *pCommandBuffers) {
+    std::shared_ptr<ObjTrackState> pool_node = nullptr;
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end() && itr->second->child_objects) {
+        pool_node = itr->second;
+    }
     for (uint32_t i = 0; i < commandBufferCount; i++) {
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
     }
+    if (pool_node) {
+        std::lock_guard<std::mutex> guard(pool_node->child_objects_lock);
+        for (uint32_t i = 0; i < commandBufferCount; i++) {
+            pool_node->child_objects->erase(HandleToUint64(pCommandBuffers[i]));
+        }
+    }
 }
 
 bool ObjectLifetimes::PreCallValidateDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
@@ -758,15 +763,6 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
     skip |= ValidateObject(descriptorPool, kVulkanObjectTypeDescriptorPool, true,
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parameter",
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parent");
-
-    auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined);
-        }
-    }
     skip |= ValidateDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, pAllocator,
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00304",
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00305");
@@ -777,11 +773,7 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
     auto lock = WriteSharedLock();
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
-        }
-        pool_node->child_objects->clear();
+        DestroyPoolChildren(*itr->second, kVulkanObjectTypeDescriptorSet);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -792,15 +784,7 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
     skip |= ValidateObject(device, kVulkanObjectTypeDevice, false, "VUID-vkDestroyCommandPool-device-parameter", kVUIDUndefined);
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent");
-
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto &itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first));
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
-                                      kVUIDUndefined, kVUIDUndefined);
-    }
+    // The pool's command buffers are tracked as its children, so they need no parent or allocator validation.
     skip |= ValidateDestroyObject(commandPool, kVulkanObjectTypeCommandPool, pAllocator,
                                   "VUID-vkDestroyCommandPool-commandPool-00042", "VUID-vkDestroyCommandPool-commandPool-00043");
     return skip;
@@ -808,11 +792,10 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator) {
-    auto snapshot = object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](std::shared_ptr<ObjTrackState> pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto &itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
+    auto itr = object_map[kVulkanObjectTypeCommandPool].find(HandleToUint64(commandPool));
+    if (itr != object_map[kVulkanObjectTypeCommandPool].end()) {
+        DestroyPoolChildren(*itr->second, kVulkanObjectTypeCommandBuffer);
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool);
 }
@@ -2359,13 +2359,12 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                                          create_info.pTessellationState, VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO,
                                          false, kVUIDUndefined, "VUID-VkPipelineTessellationStateCreateInfo-sType-sType");
 
-                const VkStructureType allowed_structs_vk_pipeline_tessellation_state_create_info[] = {
-                    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO};
+                static const AllowedStructTypes<1> allowed_structs_vk_pipeline_tessellation_state_create_info({
+                    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO});
 
                 skip |= validate_struct_pnext(
                     "vkCreateGraphicsPipelines", "pCreateInfos[i].pTessellationState->pNext",
                     "VkPipelineTessellationDomainOriginStateCreateInfo", create_info.pTessellationState->pNext,
-                    ARRAY_SIZE(allowed_structs_vk_pipeline_tessellation_state_create_info),
                     allowed_structs_vk_pipeline_tessellation_state_create_info, GeneratedVulkanHeaderVersion,
                     "VUID-VkPipelineTessellationStateCreateInfo-pNext-pNext",
                     "VUID-VkPipelineTessellationStateCreateInfo-sType-unique");
@@ -2383,7 +2382,8 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                                              "VUID-VkPipelineInputAssemblyStateCreateInfo-sType-sType");
 
                 skip |= validate_struct_pnext("vkCreateGraphicsPipelines", "pCreateInfos[i].pInputAssemblyState->pNext", NULL,
-                                              create_info.pInputAssemblyState->pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                                              create_info.pInputAssemblyState->pNext, StructTypeLookup(),
+                                              GeneratedVulkanHeaderVersion,
                                               "VUID-VkPipelineInputAssemblyStateCreateInfo-pNext-pNext", nullptr);
 
                 skip |= validate_reserved_flags("vkCreateGraphicsPipelines", "pCreateInfos[i].pInputAssemblyState->flags",
@@ -2410,11 +2410,11 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                                  i, vertex_input_state->flags);
                 }
 
-                const VkStructureType allowed_structs_vk_pipeline_vertex_input_state_create_info[] = {
-                    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT};
+                static const AllowedStructTypes<1> allowed_structs_vk_pipeline_vertex_input_state_create_info({
+                    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT});
                 skip |=
                     validate_struct_pnext("vkCreateGraphicsPipelines", "pCreateInfos[i].pVertexInputState->pNext",
-                                          "VkPipelineVertexInputDivisorStateCreateInfoEXT", create_info.pVertexInputState->pNext, 1,
+                                          "VkPipelineVertexInputDivisorStateCreateInfoEXT", create_info.pVertexInputState->pNext,
                                           allowed_structs_vk_pipeline_vertex_input_state_create_info, GeneratedVulkanHeaderVersion,
                                           "VUID-VkPipelineVertexInputStateCreateInfo-pNext-pNext",
                                           "VUID-VkPipelineVertexInputStateCreateInfo-sType-unique");
@@ -2594,12 +2594,13 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                                      "pCreateInfos[%" PRIu32 "].pTessellationState must not be NULL.",
                                      i, i);
                 } else {
-                    const VkStructureType allowed_type = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO;
+                    static const AllowedStructTypes<1> allowed_type(
+                        {VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO});
                     skip |= validate_struct_pnext(
                         "vkCreateGraphicsPipelines",
                         ParameterName("pCreateInfos[%i].pTessellationState->pNext", ParameterName::IndexVector{i}),
-                        "VkPipelineTessellationDomainOriginStateCreateInfo", create_info.pTessellationState->pNext, 1,
-                        &allowed_type, GeneratedVulkanHeaderVersion, "VUID-VkGraphicsPipelineCreateInfo-pNext-pNext",
+                        "VkPipelineTessellationDomainOriginStateCreateInfo", create_info.pTessellationState->pNext,
+                        allowed_type, GeneratedVulkanHeaderVersion, "VUID-VkGraphicsPipelineCreateInfo-pNext-pNext",
                         "VUID-VkGraphicsPipelineCreateInfo-sType-unique");
 
                     skip |= validate_reserved_flags(
@@ -2639,22 +2640,21 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                                          i);
                     }
 
-                    const VkStructureType allowed_structs_vk_pipeline_viewport_state_create_info[] = {
+                    static const AllowedStructTypes<6> allowed_structs_vk_pipeline_viewport_state_create_info({
                         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV,
                         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV,
                         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV,
                         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV,
                         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV,
                         VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT,
-                    };
+                    });
                     skip |= validate_struct_pnext(
                         "vkCreateGraphicsPipelines",
                         ParameterName("pCreateInfos[%i].pViewportState->pNext", ParameterName::IndexVector{i}),
                         "VkPipelineViewportSwizzleStateCreateInfoNV, VkPipelineViewportWScalingStateCreateInfoNV, "
                         "VkPipelineViewportExclusiveScissorStateCreateInfoNV, VkPipelineViewportShadingRateImageStateCreateInfoNV, "
                         "VkPipelineViewportCoarseSampleOrderStateCreateInfoNV, VkPipelineViewportDepthClipControlCreateInfoEXT",
-                        viewport_state.pNext, ARRAY_SIZE(allowed_structs_vk_pipeline_viewport_state_create_info),
-                        allowed_structs_vk_pipeline_viewport_state_create_info, 200,
+                        viewport_state.pNext, allowed_structs_vk_pipeline_viewport_state_create_info, 200,
                         "VUID-VkPipelineViewportStateCreateInfo-pNext-pNext",
                         "VUID-VkPipelineViewportStateCreateInfo-sType-unique");
 
@@ -3008,10 +3008,11 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                                      "is VK_FALSE, pCreateInfos[%" PRIu32 "].pMultisampleState must not be NULL.",
                                      i, i);
                 } else {
-                    const VkStructureType valid_next_stypes[] = {LvlTypeMap<VkPipelineCoverageModulationStateCreateInfoNV>::kSType,
-                                                                 LvlTypeMap<VkPipelineCoverageReductionStateCreateInfoNV>::kSType,
-                                                                 LvlTypeMap<VkPipelineCoverageToColorStateCreateInfoNV>::kSType,
-                                                                 LvlTypeMap<VkPipelineSampleLocationsStateCreateInfoEXT>::kSType};
+                    static const AllowedStructTypes<4> valid_next_stypes(
+                        {LvlTypeMap<VkPipelineCoverageModulationStateCreateInfoNV>::kSType,
+                         LvlTypeMap<VkPipelineCoverageReductionStateCreateInfoNV>::kSType,
+                         LvlTypeMap<VkPipelineCoverageToColorStateCreateInfoNV>::kSType,
+                         LvlTypeMap<VkPipelineSampleLocationsStateCreateInfoEXT>::kSType});
                     const char *valid_struct_names =
                         "VkPipelineCoverageModulationStateCreateInfoNV, VkPipelineCoverageToColorStateCreateInfoNV, "
                         "VkPipelineSampleLocationsStateCreateInfoEXT";
@@ -3021,7 +3022,7 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                         skip |= validate_struct_pnext(
                             "vkCreateGraphicsPipelines",
                             ParameterName("pCreateInfos[%i].pMultisampleState->pNext", ParameterName::IndexVector{i}),
-                            valid_struct_names, create_info.pMultisampleState->pNext, 4, valid_next_stypes,
+                            valid_struct_names, create_info.pMultisampleState->pNext, valid_next_stypes,
                             GeneratedVulkanHeaderVersion, "VUID-VkPipelineMultisampleStateCreateInfo-pNext-pNext",
                             "VUID-VkPipelineMultisampleStateCreateInfo-sType-unique");
 
@@ -3222,7 +3223,7 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                     skip |= validate_struct_pnext(
                         "vkCreateGraphicsPipelines",
                         ParameterName("pCreateInfos[%i].pDepthStencilState->pNext", ParameterName::IndexVector{i}), NULL,
-                        create_info.pDepthStencilState->pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        create_info.pDepthStencilState->pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkPipelineDepthStencilStateCreateInfo-pNext-pNext", nullptr);
 
                     skip |=
@@ -3368,9 +3369,9 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                     }
                 }
 
-                const VkStructureType allowed_structs_vk_pipeline_color_blend_state_create_info[] = {
+                static const AllowedStructTypes<2> allowed_structs_vk_pipeline_color_blend_state_create_info({
                     VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT,
-                    VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT};
+                    VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT});
 
                 if (create_info.pColorBlendState != nullptr && uses_color_attachment) {
                     skip |=
@@ -3384,8 +3385,8 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                         "vkCreateGraphicsPipelines",
                         ParameterName("pCreateInfos[%i].pColorBlendState->pNext", ParameterName::IndexVector{i}),
                         "VkPipelineColorBlendAdvancedStateCreateInfoEXT, VkPipelineColorWriteCreateInfoEXT",
-                        create_info.pColorBlendState->pNext, ARRAY_SIZE(allowed_structs_vk_pipeline_color_blend_state_create_info),
-                        allowed_structs_vk_pipeline_color_blend_state_create_info, GeneratedVulkanHeaderVersion,
+                        create_info.pColorBlendState->pNext, allowed_structs_vk_pipeline_color_blend_state_create_info,
+                        GeneratedVulkanHeaderVersion,
                         "VUID-VkPipelineColorBlendStateCreateInfo-pNext-pNext",
                         "VUID-VkPipelineColorBlendStateCreateInfo-sType-unique");
 
@@ -4648,15 +4649,14 @@ bool StatelessValidation::manual_PreCallValidateBeginCommandBuffer(VkCommandBuff
                                      "VUID-VkCommandBufferInheritanceInfo-sType-sType");
 
         if (info) {
-            const VkStructureType allowed_structs_vk_command_buffer_inheritance_info[] = {
+            static const AllowedStructTypes<4> allowed_structs_vk_command_buffer_inheritance_info({
                 VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT,
                 VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR,
                 VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD,
-                VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV};
+                VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV});
             skip |= validate_struct_pnext(
                 cmd_name, "pBeginInfo->pInheritanceInfo->pNext", "VkCommandBufferInheritanceConditionalRenderingInfoEXT",
-                info->pNext, ARRAY_SIZE(allowed_structs_vk_command_buffer_inheritance_info),
-                allowed_structs_vk_command_buffer_inheritance_info, GeneratedVulkanHeaderVersion,
+                info->pNext, allowed_structs_vk_command_buffer_inheritance_info, GeneratedVulkanHeaderVersion,
                 "VUID-VkCommandBufferInheritanceInfo-pNext-pNext", "VUID-VkCommandBufferInheritanceInfo-sType-unique");
 
             skip |= validate_bool32(cmd_name, "pBeginInfo->pInheritanceInfo->occlusionQueryEnable", info->occlusionQueryEnable);
@@ -5296,8 +5296,8 @@ bool StatelessValidation::manual_PreCallValidateQueuePresentKHR(VkQueue queue, c
                                  "extension swapchainCount is %i. These values must be equal.",
                                  pPresentInfo->swapchainCount, present_regions->swapchainCount);
             }
-            skip |= validate_struct_pnext("QueuePresentKHR", "pCreateInfo->pNext->pNext", NULL, present_regions->pNext, 0, NULL,
-                                          GeneratedVulkanHeaderVersion, "VUID-VkPresentInfoKHR-pNext-pNext",
+            skip |= validate_struct_pnext("QueuePresentKHR", "pCreateInfo->pNext->pNext", NULL, present_regions->pNext,
+                                          StructTypeLookup(), GeneratedVulkanHeaderVersion, "VUID-VkPresentInfoKHR-pNext-pNext",
                                           "VUID-VkPresentInfoKHR-sType-unique");
             skip |= validate_array("QueuePresentKHR", "pCreateInfo->pNext->swapchainCount", "pCreateInfo->pNext->pRegions",
                                    present_regions->swapchainCount, &present_regions->pRegions, true, false, kVUIDUndefined,
@@ -6583,14 +6583,14 @@ bool StatelessValidation::PreCallValidateGetDeviceGroupSurfacePresentModes2EXT(V
         pSurfaceInfo, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR, true,
         "VUID-vkGetDeviceGroupSurfacePresentModes2EXT-pSurfaceInfo-parameter", "VUID-VkPhysicalDeviceSurfaceInfo2KHR-sType-sType");
     if (pSurfaceInfo != NULL) {
-        const VkStructureType allowed_structs_VkPhysicalDeviceSurfaceInfo2KHR[] = {
+        static const AllowedStructTypes<2> allowed_structs_VkPhysicalDeviceSurfaceInfo2KHR({
             VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT,
-            VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT};
+            VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT});
 
         skip |= validate_struct_pnext("vkGetDeviceGroupSurfacePresentModes2EXT", "pSurfaceInfo->pNext",
                                       "VkSurfaceFullScreenExclusiveInfoEXT, VkSurfaceFullScreenExclusiveWin32InfoEXT",
-                                      pSurfaceInfo->pNext, ARRAY_SIZE(allowed_structs_VkPhysicalDeviceSurfaceInfo2KHR),
-                                      allowed_structs_VkPhysicalDeviceSurfaceInfo2KHR, GeneratedVulkanHeaderVersion,
+                                      pSurfaceInfo->pNext, allowed_structs_VkPhysicalDeviceSurfaceInfo2KHR,
+                                      GeneratedVulkanHeaderVersion,
                                       "VUID-VkPhysicalDeviceSurfaceInfo2KHR-pNext-pNext",
                                       "VUID-VkPhysicalDeviceSurfaceInfo2KHR-sType-unique");
 
@@ -7752,7 +7752,7 @@ bool StatelessValidation::ValidateAccelerationStructureBuildGeometryInfoKHR(
                     skip |= validate_struct_pnext(
                         api_name,
                         ParameterName("pInfos[%i].pGeometries[%i].geometry.triangles.pNext", ParameterName::IndexVector{i, j}),
-                        NULL, pInfos[i].pGeometries[j].geometry.triangles.pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        NULL, pInfos[i].pGeometries[j].geometry.triangles.pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkAccelerationStructureGeometryTrianglesDataKHR-pNext-pNext", kVUIDUndefined);
                     skip |=
                         validate_ranged_enum(api_name,
@@ -7799,7 +7799,7 @@ bool StatelessValidation::ValidateAccelerationStructureBuildGeometryInfoKHR(
                     skip |= validate_struct_pnext(
                         api_name,
                         ParameterName("pInfos[%i].pGeometries[%i].geometry.instances.pNext", ParameterName::IndexVector{i, j}),
-                        NULL, pInfos[i].pGeometries[j].geometry.instances.pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        NULL, pInfos[i].pGeometries[j].geometry.instances.pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkAccelerationStructureGeometryInstancesDataKHR-pNext-pNext", kVUIDUndefined);
 
                     skip |= validate_bool32(api_name,
@@ -7822,7 +7822,7 @@ bool StatelessValidation::ValidateAccelerationStructureBuildGeometryInfoKHR(
                     skip |= validate_struct_pnext(
                         api_name,
                         ParameterName("pInfos[%i].pGeometries[%i].geometry.aabbs.pNext", ParameterName::IndexVector{i, j}), NULL,
-                        pInfos[i].pGeometries[j].geometry.aabbs.pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        pInfos[i].pGeometries[j].geometry.aabbs.pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkAccelerationStructureGeometryAabbsDataKHR-pNext-pNext", kVUIDUndefined);
                     if (pInfos[i].pGeometries[j].geometry.aabbs.stride > UINT32_MAX) {
                         skip |= LogError(device, "VUID-VkAccelerationStructureGeometryAabbsDataKHR-stride-03820",
@@ -7875,7 +7875,7 @@ bool StatelessValidation::ValidateAccelerationStructureBuildGeometryInfoKHR(
                     skip |= validate_struct_pnext(
                         api_name,
                         ParameterName("pInfos[%i].ppGeometries[%i]->geometry.triangles.pNext", ParameterName::IndexVector{i, j}),
-                        NULL, pInfos[i].ppGeometries[j]->geometry.triangles.pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        NULL, pInfos[i].ppGeometries[j]->geometry.triangles.pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkAccelerationStructureGeometryTrianglesDataKHR-pNext-pNext", kVUIDUndefined);
                     skip |= validate_ranged_enum(api_name,
                                                  ParameterName("pInfos[%i].ppGeometries[%i]->geometry.triangles.vertexFormat",
@@ -7918,7 +7918,7 @@ bool StatelessValidation::ValidateAccelerationStructureBuildGeometryInfoKHR(
                     skip |= validate_struct_pnext(
                         api_name,
                         ParameterName("pInfos[%i].ppGeometries[%i]->geometry.instances.pNext", ParameterName::IndexVector{i, j}),
-                        NULL, pInfos[i].ppGeometries[j]->geometry.instances.pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        NULL, pInfos[i].ppGeometries[j]->geometry.instances.pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkAccelerationStructureGeometryInstancesDataKHR-pNext-pNext", kVUIDUndefined);
                     skip |= validate_bool32(api_name,
                                             ParameterName("pInfos[%i].ppGeometries[%i]->geometry.instances.arrayOfPointers",
@@ -7940,7 +7940,7 @@ bool StatelessValidation::ValidateAccelerationStructureBuildGeometryInfoKHR(
                     skip |= validate_struct_pnext(
                         api_name,
                         ParameterName("pInfos[%i].ppGeometries[%i]->geometry.aabbs.pNext", ParameterName::IndexVector{i, j}), NULL,
-                        pInfos[i].ppGeometries[j]->geometry.aabbs.pNext, 0, NULL, GeneratedVulkanHeaderVersion,
+                        pInfos[i].ppGeometries[j]->geometry.aabbs.pNext, StructTypeLookup(), GeneratedVulkanHeaderVersion,
                         "VUID-VkAccelerationStructureGeometryAabbsDataKHR-pNext-pNext", kVUIDUndefined);
                     if (pInfos[i].ppGeometries[j]->geometry.aabbs.stride > UINT32_MAX) {
                         skip |= LogError(device, "VUID-VkAccelerationStructureGeometryAabbsDataKHR-stride-03820",
@@ -8697,16 +8697,16 @@ bool StatelessValidation::manual_PreCallValidateGetDeviceImageSparseMemoryRequir
 bool StatelessValidation::manual_PreCallValidateExportMetalObjectsEXT(VkDevice device,
                                                                       VkExportMetalObjectsInfoEXT *pMetalObjectsInfo) const {
     bool skip = false;
-    const VkStructureType allowed_structs_vk_export_metal_objects_info[] = {
+    static const AllowedStructTypes<6> allowed_structs_vk_export_metal_objects_info({
         VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT,       VK_STRUCTURE_TYPE_EXPORT_METAL_COMMAND_QUEUE_INFO_EXT,
         VK_STRUCTURE_TYPE_EXPORT_METAL_DEVICE_INFO_EXT,       VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT,
         VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT, VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT,
-    };
+    });
     skip |= validate_struct_pnext("vkExportMetalObjectsEXT", "pMetalObjectsInfo->pNext",
                                   "VkExportMetalBufferInfoEXT, VkExportMetalCommandQueueInfoEXT, VkExportMetalDeviceInfoEXT, "
                                   "VkExportMetalIOSurfaceInfoEXT, VkExportMetalSharedEventInfoEXT, VkExportMetalTextureInfoEXT",
-                                  pMetalObjectsInfo->pNext, ARRAY_SIZE(allowed_structs_vk_export_metal_objects_info),
-                                  allowed_structs_vk_export_metal_objects_info, GeneratedVulkanHeaderVersion,
+                                  pMetalObjectsInfo->pNext, allowed_structs_vk_export_metal_objects_info,
+                                  GeneratedVulkanHeaderVersion,
                                   "VUID-VkExportMetalObjectsInfoEXT-pNext-pNext", "VUID-VkExportMetalObjectsInfoEXT-sType-unique",
                                   false, true);
     return skip;
@@ -556,6 +556,18 @@ void LAST_BOUND_STATE::UnbindAndResetPushDescriptorSet(CMD_BUFFER_STATE *cb_stat
     push_descriptor_set = std::move(ds);
 }
 
+std::shared_ptr<cvdescriptorset::DescriptorSet> LAST_BOUND_STATE::GetPushDescriptorSet(
+    const std::shared_ptr<cvdescriptorset::DescriptorSetLayout const> &dsl, const ValidationStateTracker *dev_data) {
+    auto &pooled = push_descriptor_set_pool[dsl.get()];
+    if (pooled) {
+        // Only ever bound at this bind point, as the push descriptor set, which the caller is about to replace
+        pooled->ResetPushDescriptorSet();
+    } else {
+        pooled = std::make_shared<cvdescriptorset::DescriptorSet>(VK_NULL_HANDLE, nullptr, dsl, 0, dev_data);
+    }
+    return pooled;
+}
+
 void LAST_BOUND_STATE::Reset() {
     pipeline_state = nullptr;
     pipeline_layout = VK_NULL_HANDLE;
@@ -563,5 +575,6 @@ void LAST_BOUND_STATE::Reset() {
         push_descriptor_set->Destroy();
     }
     push_descriptor_set.reset();
+    push_descriptor_set_pool.clear();
     per_set.clear();
 }
@@ -622,9 +622,17 @@ struct LAST_BOUND_STATE {
 
     std::vector<PER_SET> per_set;
 
+    // Push descriptor sets used at this bind point during the recording, one per set layout. A push that disturbs the
+    // current push descriptor set recycles the pooled set for its layout instead of creating a new one.
+    layer_data::unordered_map<const cvdescriptorset::DescriptorSetLayout *, std::shared_ptr<cvdescriptorset::DescriptorSet>>
+        push_descriptor_set_pool;
+
     void Reset();
 
     void UnbindAndResetPushDescriptorSet(CMD_BUFFER_STATE *cb_state, std::shared_ptr<cvdescriptorset::DescriptorSet> &&ds);
+    // Returns an empty push descriptor set for dsl, reset from the pool when possible
+    std::shared_ptr<cvdescriptorset::DescriptorSet> GetPushDescriptorSet(
+        const std::shared_ptr<cvdescriptorset::DescriptorSetLayout const> &dsl, const ValidationStateTracker *dev_data);
 
     inline bool IsUsing() const { return pipeline_state ? true : false; }
 };
@@ -1780,6 +1780,34 @@ bool splice(RangeMap &to, const RangeMap &from, value_precedence arbiter) {
     return splice(to, from, arbiter, from.cbegin(), from.cend());
 }
 
+// Merge each run of abutting ranges with equal values into a single entry, returning the number of entries removed
+template <typename RangeMap>
+size_t consolidate(RangeMap &map) {
+    using Key = typename RangeMap::key_type;
+    using Mapped = typename RangeMap::mapped_type;
+    size_t removed = 0;
+    auto current = map.begin();
+    while (current != map.end()) {
+        Key merged = current->first;
+        size_t run = 1;
+        auto next = current;
+        ++next;
+        while ((next != map.end()) && merged.is_prior_to(next->first) && (next->second == current->second)) {
+            merged.end = next->first.end;
+            ++next;
+            ++run;
+        }
+        if (run > 1) {
+            Mapped value = current->second;  // intentional copy, as the source entry is about to be erased
+            map.erase(current, next);
+            map.insert(std::make_pair(merged, std::move(value)));
+            removed += run - 1;
+        }
+        current = next;
+    }
+    return removed;
+}
+
 template <typename Map, typename Range = typename Map::key_type, typename MapValue = typename Map::mapped_type>
 bool update_range_value(Map &map, const Range &range, MapValue &&value, value_precedence precedence) {
     using CachedLowerBound = typename sparse_container::cached_lower_bound_impl<Map>;
@@ -3986,7 +3986,12 @@ void ValidationStateTracker::PreCallRecordDestroyDescriptorUpdateTemplateKHR(VkD
 
 void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
                                                                        VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate) {
-    Add(std::make_shared<UPDATE_TEMPLATE_STATE>(*pDescriptorUpdateTemplate, pCreateInfo));
+    // Descriptor set templates always update sets of the create-time layout, so their writes can be planned up front
+    std::shared_ptr<cvdescriptorset::DescriptorSetLayout> layout;
+    if (pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        layout = Get<cvdescriptorset::DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    }
+    Add(std::make_shared<UPDATE_TEMPLATE_STATE>(*pDescriptorUpdateTemplate, pCreateInfo, layout.get()));
 }
 
 void ValidationStateTracker::PostCallRecordCreateDescriptorUpdateTemplate(VkDevice device,
@@ -4172,6 +4177,22 @@ void ValidationStateTracker::PostCallRecordResetQueryPool(VkDevice device, VkQue
 void ValidationStateTracker::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
                                                                         const UPDATE_TEMPLATE_STATE *template_state,
                                                                         const void *pData) {
+    if (template_state->create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        // Apply the precompiled writes one at a time, without building a decoded copy of the update
+        auto set_node = Get<cvdescriptorset::DescriptorSet>(descriptorSet);
+        if (!set_node) return;
+        const auto &plan = template_state->plan;
+        VkWriteDescriptorSet write;
+        VkWriteDescriptorSetInlineUniformBlockEXT inline_info;
+        VkWriteDescriptorSetAccelerationStructureKHR inline_info_khr;
+        VkWriteDescriptorSetAccelerationStructureNV inline_info_nv;
+        cvdescriptorset::UpdateStateCache state_cache(this);
+        for (size_t i = 0; i < plan.writes.size(); i++) {
+            plan.Decode(i, descriptorSet, pData, &write, &inline_info, &inline_info_khr, &inline_info_nv);
+            set_node->PerformWriteUpdate(&state_cache, &write);
+        }
+        return;
+    }
     // Translate the templated update into a normal update for validation...
     cvdescriptorset::DecodedTemplateUpdate decoded_update(this, descriptorSet, template_state, pData);
     cvdescriptorset::PerformUpdateDescriptorSets(this, static_cast<uint32_t>(decoded_update.desc_writes.size()),
@@ -21,6 +21,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
 #include "parameter_name.h"
 #include "vk_typemap_helper.h"
 #include "sync_utils.h"
@@ -45,6 +49,49 @@ static const char DECORATE_UNUSED *kVUID_PVError_ApiVersionViolation = "UNASSIGN
 // static const char DECORATE_UNUSED *kVUID_PVError_FailureCode = "UNASSIGNED-GeneralParameterError-FailureCode";
 // static const char DECORATE_UNUSED *kVUID_PVError_DeviceFeature = "UNASSIGNED-GeneralParameterError-DeviceFeature";
 
+// Valid tokens of a Vulkan enumeration, stored as sorted and coalesced [first, last] ranges.
+// Core tokens are contiguous and extension tokens are allocated in dense blocks, so even VkFormat
+// collapses into a few dozen ranges and a lookup is a short binary search rather than a scan of
+// every token.  The ranges are built once when the generated tables are initialized.
+template <typename T>
+class ValidEnumValues {
+  public:
+    ValidEnumValues(std::initializer_list<T> values) {
+        std::vector<int32_t> sorted;
+        sorted.reserve(values.size());
+        for (const auto value : values) {
+            sorted.push_back(static_cast<int32_t>(value));
+        }
+        std::sort(sorted.begin(), sorted.end());
+        for (const auto value : sorted) {
+            if (!ranges_.empty() && (static_cast<int64_t>(ranges_.back().last) + 1 >= value)) {
+                ranges_.back().last = std::max(ranges_.back().last, value);
+            } else {
+                ranges_.push_back({value, value});
+            }
+        }
+        ranges_.shrink_to_fit();
+    }
+
+    bool contains(T value) const {
+        const int32_t key = static_cast<int32_t>(value);
+        auto it = std::upper_bound(ranges_.cbegin(), ranges_.cend(), key,
+                                   [](int32_t lhs, const Range &rhs) { return lhs < rhs.first; });
+        if (it == ranges_.cbegin()) {
+            return false;
+        }
+        --it;
+        return key <= it->last;
+    }
+
+  private:
+    struct Range {
+        int32_t first;
+        int32_t last;
+    };
+    std::vector<Range> ranges_;
+};
+
 extern const uint32_t GeneratedVulkanHeaderVersion;
 
 // Some flags and enums are never used in and won't be generated by default
@@ -60,18 +107,18 @@ extern const VkGeometryFlagsKHR AllVkGeometryFlagBitsKHR;
 extern const VkPipelineColorBlendStateCreateFlags AllVkPipelineColorBlendStateCreateFlagBits;
 extern const VkPipelineDepthStencilStateCreateFlags AllVkPipelineDepthStencilStateCreateFlagBits;
 
-extern const std::vector<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
-extern const std::vector<VkCompareOp> AllVkCompareOpEnums;
-extern const std::vector<VkStencilOp> AllVkStencilOpEnums;
-extern const std::vector<VkBlendFactor> AllVkBlendFactorEnums;
-extern const std::vector<VkBlendOp> AllVkBlendOpEnums;
-extern const std::vector<VkLogicOp> AllVkLogicOpEnums;
-extern const std::vector<VkBorderColor> AllVkBorderColorEnums;
-extern const std::vector<VkImageLayout> AllVkImageLayoutEnums;
-extern const std::vector<VkFormat> AllVkFormatEnums;
-extern const std::vector<VkVertexInputRate> AllVkVertexInputRateEnums;
-extern const std::vector<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
-extern const std::vector<VkIndexType> AllVkIndexTypeEnums;
+extern const ValidEnumValues<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
+extern const ValidEnumValues<VkCompareOp> AllVkCompareOpEnums;
+extern const ValidEnumValues<VkStencilOp> AllVkStencilOpEnums;
+extern const ValidEnumValues<VkBlendFactor> AllVkBlendFactorEnums;
+extern const ValidEnumValues<VkBlendOp> AllVkBlendOpEnums;
+extern const ValidEnumValues<VkLogicOp> AllVkLogicOpEnums;
+extern const ValidEnumValues<VkBorderColor> AllVkBorderColorEnums;
+extern const ValidEnumValues<VkImageLayout> AllVkImageLayoutEnums;
+extern const ValidEnumValues<VkFormat> AllVkFormatEnums;
+extern const ValidEnumValues<VkVertexInputRate> AllVkVertexInputRateEnums;
+extern const ValidEnumValues<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
+extern const ValidEnumValues<VkIndexType> AllVkIndexTypeEnums;
 
 extern std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
 
@@ -89,6 +136,227 @@ const uint32_t ExtEnumBaseValue = 1000000000;
 // The value of all VK_xxx_MAX_ENUM tokens
 const uint32_t MaxEnumValue = 0x7FFFFFFF;
 
+// Read only view of an AllowedStructTypes hash set, so validate_struct_pnext doesn't depend on its size. A default constructed
+// view is empty, for structs that allow no pNext chain.
+class StructTypeLookup {
+  public:
+    StructTypeLookup() : slots_(nullptr), mask_(0), count_(0) {}
+    StructTypeLookup(const VkStructureType *slots, uint32_t mask, uint32_t count) : slots_(slots), mask_(mask), count_(count) {}
+
+    uint32_t size() const { return count_; }
+    bool contains(VkStructureType s_type) const {
+        // MAX_ENUM marks the empty slots, so it is never a member
+        if ((count_ == 0) || (s_type == VK_STRUCTURE_TYPE_MAX_ENUM)) return false;
+        for (uint32_t index = Hash(s_type) & mask_;; index = (index + 1) & mask_) {
+            if (slots_[index] == s_type) return true;
+            if (slots_[index] == VK_STRUCTURE_TYPE_MAX_ENUM) return false;
+        }
+    }
+
+    // Extension sTypes differ mostly in their middle digits, so mix the product's high bits down before masking
+    static uint32_t Hash(VkStructureType s_type) {
+        const uint32_t hash = static_cast<uint32_t>(s_type) * 0x9E3779B1u;
+        return hash ^ (hash >> 15);
+    }
+
+  private:
+    const VkStructureType *slots_;
+    uint32_t mask_;
+    uint32_t count_;
+};
+
+// The smallest power of two at least twice count, so an AllowedStructTypes table is never more than half full
+constexpr uint32_t StructTypeTableSize(uint32_t count, uint32_t size = 2) {
+    return (size >= 2 * count) ? size : StructTypeTableSize(count, size * 2);
+}
+
+// Open addressed hash set of the sTypes a struct allows in its pNext chain. VkStructureType values are sparse, so each chain
+// element is checked with a hash and a short probe rather than a scan of the allow-list. The generated code declares one per
+// parent struct as a function local static, so it is built on first use only.
+template <uint32_t N>
+class AllowedStructTypes {
+  public:
+    explicit AllowedStructTypes(std::initializer_list<VkStructureType> s_types) {
+        assert(s_types.size() <= N);
+        slots_.fill(VK_STRUCTURE_TYPE_MAX_ENUM);
+        for (const auto s_type : s_types) {
+            uint32_t index = StructTypeLookup::Hash(s_type) & kMask;
+            while ((slots_[index] != VK_STRUCTURE_TYPE_MAX_ENUM) && (slots_[index] != s_type)) {
+                index = (index + 1) & kMask;
+            }
+            slots_[index] = s_type;
+        }
+    }
+    operator StructTypeLookup() const { return StructTypeLookup(slots_.data(), kMask, N); }
+
+  private:
+    static constexpr uint32_t kMask = StructTypeTableSize(N) - 1;
+    std::array<VkStructureType, kMask + 1> slots_;
+};
+
+// Create infos whose members are plain values, so that two of them with the same member values always validate the same way.
+template <typename CreateInfo>
+struct IsMemoizableCreateInfo : std::false_type {};
+template <>
+struct IsMemoizableCreateInfo<VkSamplerCreateInfo> : std::true_type {};
+template <>
+struct IsMemoizableCreateInfo<VkImageViewCreateInfo> : std::true_type {};
+
+// Remembers create infos that already passed stateless validation without logging anything, so that re-creating an object
+// from an identical create info (including its pNext chain) can skip the checks.  A chain containing any structure not
+// handled by AppendChained() is never cached, and neither is a call with allocation callbacks or a missing output pointer,
+// since those are validated outside of the create info.
+class CreateInfoMemo {
+  public:
+    struct Ticket {
+        bool hit = false;
+        bool cacheable = false;
+        uint64_t log_msg_request_count = 0;
+    };
+
+    template <typename CreateInfo>
+    Ticket Lookup(const debug_report_data *report_data, const CreateInfo *create_info, const VkAllocationCallbacks *allocator,
+                  const void *output) const {
+        static_assert(IsMemoizableCreateInfo<CreateInfo>::value, "create info has no memo key");
+        Ticket ticket;
+        if (!create_info || allocator || !output) {
+            return ticket;
+        }
+        std::string &key = ThreadKey();
+        if (!BuildKey(*create_info, key)) {
+            return ticket;
+        }
+        ticket.log_msg_request_count = report_data->log_msg_request_count.load(std::memory_order_relaxed);
+        ReadLockGuard guard(lock_);
+        ticket.hit = entries_.find(key) != entries_.end();
+        ticket.cacheable = !ticket.hit;
+        return ticket;
+    }
+
+    // Must be called on the thread that obtained the ticket, after all of the checks for the call have run
+    void Record(const debug_report_data *report_data, const Ticket &ticket, bool skip) const {
+        // Any message logged meanwhile, even by another thread or a filtered one, keeps the create info out of the cache
+        if (!ticket.cacheable || skip ||
+            report_data->log_msg_request_count.load(std::memory_order_relaxed) != ticket.log_msg_request_count) {
+            return;
+        }
+        WriteLockGuard guard(lock_);
+        if (entries_.size() >= static_cast<size_t>(kMaxEntries)) {
+            entries_.clear();
+        }
+        entries_.insert(ThreadKey());
+    }
+
+  private:
+    static constexpr uint32_t kMaxEntries = 1024;
+    static constexpr uint32_t kMaxChainLength = 8;
+
+    static std::string &ThreadKey() {
+        static thread_local std::string key;
+        return key;
+    }
+
+    // The key is each structure's sType followed by its members one at a time, leaving out the pNext pointers. Appending whole
+    // structures would also copy their padding, whose indeterminate bytes could make equal create infos miss.
+    template <typename T>
+    static void Append(std::string &key, const T &value) {
+        static_assert(std::is_scalar<T>::value, "only scalar members are free of padding");
+        key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+    static void Append(std::string &key, const VkComponentMapping &components) {
+        Append(key, components.r);
+        Append(key, components.g);
+        Append(key, components.b);
+        Append(key, components.a);
+    }
+
+    static void AppendMembers(const VkSamplerCreateInfo &info, std::string &key) {
+        Append(key, info.flags);
+        Append(key, info.magFilter);
+        Append(key, info.minFilter);
+        Append(key, info.mipmapMode);
+        Append(key, info.addressModeU);
+        Append(key, info.addressModeV);
+        Append(key, info.addressModeW);
+        Append(key, info.mipLodBias);
+        Append(key, info.anisotropyEnable);
+        Append(key, info.maxAnisotropy);
+        Append(key, info.compareEnable);
+        Append(key, info.compareOp);
+        Append(key, info.minLod);
+        Append(key, info.maxLod);
+        Append(key, info.borderColor);
+        Append(key, info.unnormalizedCoordinates);
+    }
+    static void AppendMembers(const VkImageViewCreateInfo &info, std::string &key) {
+        Append(key, info.flags);
+        Append(key, info.image);
+        Append(key, info.viewType);
+        Append(key, info.format);
+        Append(key, info.components);
+        Append(key, info.subresourceRange.aspectMask);
+        Append(key, info.subresourceRange.baseMipLevel);
+        Append(key, info.subresourceRange.levelCount);
+        Append(key, info.subresourceRange.baseArrayLayer);
+        Append(key, info.subresourceRange.layerCount);
+    }
+
+    // Returns false for a structure that can't be part of a cached chain
+    static bool AppendChained(const VkBaseInStructure *header, std::string &key) {
+        Append(key, header->sType);
+        switch (header->sType) {
+            case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+                Append(key, reinterpret_cast<const VkSamplerReductionModeCreateInfo *>(header)->reductionMode);
+                return true;
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+                Append(key, reinterpret_cast<const VkSamplerYcbcrConversionInfo *>(header)->conversion);
+                return true;
+            case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: {
+                const auto *info = reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT *>(header);
+                for (const uint32_t value : info->customBorderColor.uint32) {
+                    Append(key, value);
+                }
+                Append(key, info->format);
+                return true;
+            }
+            case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: {
+                const auto *info = reinterpret_cast<const VkSamplerBorderColorComponentMappingCreateInfoEXT *>(header);
+                Append(key, info->components);
+                Append(key, info->srgb);
+                return true;
+            }
+            case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+                Append(key, reinterpret_cast<const VkImageViewUsageCreateInfo *>(header)->usage);
+                return true;
+            case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT:
+                Append(key, reinterpret_cast<const VkImageViewASTCDecodeModeEXT *>(header)->decodeMode);
+                return true;
+            case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT:
+                Append(key, reinterpret_cast<const VkImageViewMinLodCreateInfoEXT *>(header)->minLod);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    template <typename CreateInfo>
+    static bool BuildKey(const CreateInfo &create_info, std::string &key) {
+        key.clear();
+        Append(key, create_info.sType);
+        AppendMembers(create_info, key);
+        uint32_t chain_length = 0;
+        for (auto *next = static_cast<const VkBaseInStructure *>(create_info.pNext); next != nullptr; next = next->pNext) {
+            if ((++chain_length > kMaxChainLength) || !AppendChained(next, key)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    mutable ReadWriteLock lock_;
+    mutable layer_data::unordered_set<std::string> entries_;
+};
+
 class StatelessValidation : public ValidationObject {
   public:
     VkPhysicalDeviceLimits device_limits = {};
@@ -129,6 +397,9 @@ class StatelessValidation : public ValidationObject {
     mutable std::mutex renderpass_map_mutex;
     layer_data::unordered_map<VkRenderPass, SubpassesUsageStates> renderpasses_states;
 
+    // Create infos that already validated clean, for the entry points listed in the generator's memoized_create_functions
+    CreateInfoMemo create_info_memo;
+
     // Constructor for stateles validation tracking
     StatelessValidation() : device_createinfo_pnext(nullptr) { container_type = LayerObjectTypeParameterValidation; }
     ~StatelessValidation() {
@@ -547,50 +818,50 @@ class StatelessValidation : public ValidationObject {
      * @param parameter_name Name of parameter being validated.
      * @param allowed_struct_names Names of allowed structs.
      * @param next Pointer to validate.
-     * @param allowed_type_count Total number of allowed structure types.
-     * @param allowed_types Array of structure types allowed for pNext.
+     * @param allowed_types Hash set of the structure types allowed for pNext, empty if none are.
      * @param header_version Version of header defining the pNext validation rules.
      * @return Boolean value indicating that the call should be skipped.
      */
     bool validate_struct_pnext(const char *api_name, const ParameterName &parameter_name, const char *allowed_struct_names,
-                               const void *next, size_t allowed_type_count, const VkStructureType *allowed_types,
-                               uint32_t header_version, const char *pnext_vuid, const char *stype_vuid,
+                               const void *next, const StructTypeLookup &allowed_types, uint32_t header_version,
+                               const char *pnext_vuid, const char *stype_vuid,
                                const bool is_physdev_api = false, const bool is_const_param = true) const {
         bool skip_call = false;
 
         if (next != nullptr) {
-            layer_data::unordered_set<const void *> cycle_check;
-            layer_data::unordered_set<VkStructureType, layer_data::hash<int>> unique_stype_check;
+            // Chains are short, so a linear scan over an inline buffer is cheaper than hashing and never allocates
+            small_vector<VkStructureType, 8, uint32_t> unique_stype_check;
 
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
                 "you are using a struct from a private extension or an extension that was added to a later version of the Vulkan "
                 "header, in which case the use of %s is undefined and may not work correctly with validation enabled";
 
-            if ((allowed_type_count == 0) && (custom_stype_info.size() == 0)) {
+            if ((allowed_types.size() == 0) && (custom_stype_info.size() == 0)) {
                 std::string message = "%s: value of %s must be NULL. ";
                 message += disclaimer;
                 skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
                                       header_version, parameter_name.get_name().c_str());
             } else {
-                const VkStructureType *start = allowed_types;
-                const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
                 while (current != nullptr) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end() &&
-                            !IsDuplicatePnext(current->sType)) {
-                            // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
-                            std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
-                            skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
+                    // Only compare the API name when the sType is one of the loader structs
+                    if (!((current->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO) &&
+                          (strncmp(api_name, "vkCreateInstance", strlen(api_name)) == 0)) &&
+                        !((current->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO) &&
+                          (strncmp(api_name, "vkCreateDevice", strlen(api_name)) == 0))) {
+                        if (std::find(unique_stype_check.begin(), unique_stype_check.end(), current->sType) !=
+                            unique_stype_check.end()) {
+                            if (!IsDuplicatePnext(current->sType)) {
+                                // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
+                                std::string message =
+                                    "%s: %s chain contains duplicate structure types: %s appears multiple times.";
+                                skip_call |= LogError(device, stype_vuid, message.c_str(), api_name,
+                                                      parameter_name.get_name().c_str(), string_VkStructureType(current->sType));
+                            }
                         } else {
-                            unique_stype_check.insert(current->sType);
+                            unique_stype_check.emplace_back(current->sType);
                         }
 
                         // Search custom stype list -- if sType found, skip this entirely
@@ -602,8 +873,9 @@ class StatelessValidation : public ValidationObject {
                             }
                         }
                         if (!custom) {
-                            if (std::find(start, end, current->sType) == end) {
-                                if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                            if (!allowed_types.contains(current->sType)) {
+                                const char *type_name = string_VkStructureType(current->sType);
+                                if (UnsupportedStructureTypeString.compare(type_name) == 0) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
                                         "are [%s]. ";
@@ -617,8 +889,8 @@ class StatelessValidation : public ValidationObject {
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), type_name.c_str(),
-                                                          allowed_struct_names, header_version, parameter_name.get_name().c_str());
+                                                          parameter_name.get_name().c_str(), type_name, allowed_struct_names,
+                                                          header_version, parameter_name.get_name().c_str());
                                 }
                             }
                             skip_call |= ValidatePnextStructContents(api_name, parameter_name, current, pnext_vuid, is_physdev_api,
@@ -703,16 +975,16 @@ class StatelessValidation : public ValidationObject {
      * @param apiName Name of API call being validated.
      * @param parameterName Name of parameter being validated.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
+     * @param valid_values The set of valid values for the enumeration.
      * @param value Enumeration value to validate.
      * @return Boolean value indicating that the call should be skipped.
      */
     template <typename T>
     bool validate_ranged_enum(const char *apiName, const ParameterName &parameterName, const char *enumName,
-                              const std::vector<T> &valid_values, T value, const char *vuid) const {
+                              const ValidEnumValues<T> &valid_values, T value, const char *vuid) const {
         bool skip = false;
 
-        if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
+        if (!valid_values.contains(value)) {
             skip |=
                 LogError(device, vuid,
                          "%s: value of %s (%d) does not fall within the begin..end range of the core %s enumeration tokens and is "
@@ -737,7 +1009,7 @@ class StatelessValidation : public ValidationObject {
      * @param countName Name of count parameter.
      * @param arrayName Name of array parameter.
      * @param enumName Name of the enumeration being validated.
-     * @param valid_values The list of valid values for the enumeration.
+     * @param valid_values The set of valid values for the enumeration.
      * @param count Number of enumeration values in the array.
      * @param array Array of enumeration values to validate.
      * @param countRequired The 'count' parameter may not be 0 when true.
@@ -746,7 +1018,7 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_ranged_enum_array(const char *apiName, const ParameterName &countName, const ParameterName &arrayName,
-                                    const char *enumName, const std::vector<T> &valid_values, uint32_t count, const T *array,
+                                    const char *enumName, const ValidEnumValues<T> &valid_values, uint32_t count, const T *array,
                                     bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
 
@@ -755,7 +1027,7 @@ class StatelessValidation : public ValidationObject {
                                         kVUIDUndefined);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!valid_values.contains(array[i])) {
                     skip_call |= LogError(device, kVUID_PVError_UnrecognizedValue,
                                           "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
                                           "enumeration tokens and is not an extension added token",
@@ -769,7 +1041,7 @@ class StatelessValidation : public ValidationObject {
 
     template <typename T>
     bool validate_ranged_enum_array(const char *apiName, const char *vuid, const ParameterName &countName,
-                                    const ParameterName &arrayName, const char *enumName, const std::vector<T> &valid_values,
+                                    const ParameterName &arrayName, const char *enumName, const ValidEnumValues<T> &valid_values,
                                     uint32_t count, const T *array, bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
 
@@ -777,7 +1049,7 @@ class StatelessValidation : public ValidationObject {
             skip_call |= validate_array(apiName, countName, arrayName, count, &array, countRequired, arrayRequired, vuid, vuid);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
+                if (!valid_values.contains(array[i])) {
                     skip_call |= LogError(device, vuid,
                                           "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
                                           "enumeration tokens and is not an extension added token",
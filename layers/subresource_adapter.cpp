@@ -23,6 +23,7 @@
 #include "vk_format_utils.h"
 #include <cmath>
 #include "image_state.h"
+#include "hash_vk_types.h"
 #include "layer_chassis_dispatch.h"
 
 namespace subresource_adapter {
@@ -854,4 +855,40 @@ void ImageRangeGenerator::IncrementerState::Set(uint32_t y_count_, uint32_t laye
     incr_layer_z = z_step;
 }
 
+std::shared_ptr<const ImageRangeCache::RangeList> ImageRangeCache::Generate(const ImageRangeEncoder& encoder,
+                                                                            const VkImageSubresourceRange& subres_range,
+                                                                            bool is_depth_sliced) {
+    auto ranges = std::make_shared<RangeList>();
+    for (ImageRangeGenerator range_gen(encoder, subres_range, 0, is_depth_sliced); range_gen->non_empty(); ++range_gen) {
+        ranges->emplace_back(*range_gen);
+    }
+    return ranges;
+}
+
+const std::shared_ptr<const ImageRangeCache::RangeList>& ImageRangeCache::GetWholeImage(const ImageRangeEncoder& encoder,
+                                                                                       bool is_depth_sliced) {
+    const size_t index = is_depth_sliced ? 1 : 0;
+    std::call_once(once_[index], [this, &encoder, is_depth_sliced, index]() {
+        whole_ranges_[index] = Generate(encoder, encoder.FullRange(), is_depth_sliced);
+    });
+    return whole_ranges_[index];
+}
+
+bool ImageRangeEncoder::IsWholeImage(const VkImageSubresourceRange& subres_range) const {
+    return GetRemaining(FullRange(), subres_range) == FullRange();
+}
+
+std::shared_ptr<const ImageRangeCache::RangeList> ImageRangeEncoder::GetRanges(const VkImageSubresourceRange& subres_range,
+                                                                               bool is_depth_sliced) const {
+    if (IsWholeImage(subres_range)) return range_cache_.GetWholeImage(*this, is_depth_sliced);
+    return ImageRangeCache::Generate(*this, subres_range, is_depth_sliced);
+}
+
+RangeListGenerator ImageRangeEncoder::MakeRangeListGenerator(const VkImageSubresourceRange& subres_range, IndexType base_address,
+                                                             bool is_depth_sliced) const {
+    if (IsWholeImage(subres_range)) return RangeListGenerator(range_cache_.GetWholeImage(*this, is_depth_sliced), base_address);
+    // Per mip or per layer barriers rarely repeat a range, so walk the generator rather than allocating a list
+    return RangeListGenerator(ImageRangeGenerator(*this, subres_range, base_address, is_depth_sliced));
+}
+
 };  // namespace subresource_adapter
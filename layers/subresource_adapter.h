@@ -25,9 +25,12 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "range_vector.h"
 #include "vk_layer_data.h"
+#include "vk_layer_utils.h"
 #ifndef SPARSE_CONTAINER_UNIT_TEST
 #include "vulkan/vulkan.h"
 #else
@@ -344,6 +347,29 @@ class RangeGenerator {
     uint32_t aspect_index_ = 0;
 };
 
+class ImageRangeEncoder;
+
+// Remembers the ImageRangeGenerator output for the whole image. The lists are generated at base address zero, so they are
+// valid for any binding of the image. Partial ranges aren't cached here: barriers on them walk ImageRangeGenerator
+// directly, and image views memoize their own ranges.
+class ImageRangeCache {
+  public:
+    using RangeList = std::vector<IndexRange>;
+    ImageRangeCache() : once_(), whole_ranges_() {}
+    // The cached lists are only valid for the encoder that produced them, so copies start out empty
+    ImageRangeCache(const ImageRangeCache&) : ImageRangeCache() {}
+    ImageRangeCache& operator=(const ImageRangeCache&) = delete;
+
+    const std::shared_ptr<const RangeList>& GetWholeImage(const ImageRangeEncoder& encoder, bool is_depth_sliced);
+    static std::shared_ptr<const RangeList> Generate(const ImageRangeEncoder& encoder, const VkImageSubresourceRange& subres_range,
+                                                     bool is_depth_sliced);
+
+  private:
+    // Indexed by is_depth_sliced
+    std::array<std::once_flag, 2> once_;
+    std::array<std::shared_ptr<const RangeList>, 2> whole_ranges_;
+};
+
 class ImageRangeEncoder : public RangeEncoder {
   public:
     struct SubresInfo {
@@ -384,6 +410,15 @@ class ImageRangeEncoder : public RangeEncoder {
     inline bool IsCompressed() const { return is_compressed_; }
     const VkExtent3D& TexelExtent() const { return texel_extent_; }
 
+    bool IsWholeImage(const VkImageSubresourceRange& subres_range) const;
+    // The (base address zero) ranges covering the whole extent of subres_range. The whole image list is generated once and
+    // then reused, other lists are generated on each call and should be memoized by the caller.
+    std::shared_ptr<const ImageRangeCache::RangeList> GetRanges(const VkImageSubresourceRange& subres_range,
+                                                                bool is_depth_sliced) const;
+    // Walks the cached list for the whole image, or ImageRangeGenerator for any other range
+    RangeListGenerator MakeRangeListGenerator(const VkImageSubresourceRange& subres_range, IndexType base_address,
+                                              bool is_depth_sliced) const;
+
     using SubresInfoVector = std::vector<SubresInfo>;
 
   private:
@@ -397,6 +432,7 @@ class ImageRangeEncoder : public RangeEncoder {
     bool linear_image_;
     bool y_interleave_;
     bool is_compressed_;
+    mutable ImageRangeCache range_cache_;
 };
 
 class ImageRangeGenerator {
@@ -467,6 +503,46 @@ class ImageRangeGenerator {
     bool is_depth_sliced_ = false;
 };
 
+// Walks a precomputed list of ranges, offset by base_address, or an ImageRangeGenerator for ranges without a list
+class RangeListGenerator {
+  public:
+    using RangeList = ImageRangeCache::RangeList;
+    RangeListGenerator() : list_(), base_address_(0), index_(0), range_gen_(), pos_() {}
+    RangeListGenerator(const std::shared_ptr<const RangeList>& list, IndexType base_address)
+        : list_(list), base_address_(base_address), index_(0), range_gen_(), pos_() {
+        SetPos();
+    }
+    explicit RangeListGenerator(const ImageRangeGenerator& range_gen)
+        : list_(), base_address_(0), index_(0), range_gen_(range_gen), pos_(*range_gen) {}
+    inline const IndexRange& operator*() const { return pos_; }
+    inline const IndexRange* operator->() const { return &pos_; }
+    RangeListGenerator& operator++() {
+        if (list_) {
+            ++index_;
+            SetPos();
+        } else if (pos_.non_empty()) {
+            ++range_gen_;
+            pos_ = *range_gen_;
+        }
+        return *this;
+    }
+
+  private:
+    void SetPos() {
+        if (list_ && (index_ < list_->size())) {
+            const IndexRange& range = (*list_)[index_];
+            pos_ = {range.begin + base_address_, range.end + base_address_};
+        } else {
+            pos_ = {0, 0};
+        }
+    }
+    std::shared_ptr<const RangeList> list_;
+    IndexType base_address_;
+    size_t index_;
+    ImageRangeGenerator range_gen_;
+    IndexRange pos_;
+};
+
 // double wrapped map variants.. to avoid needing to templatize on the range map type.  The underlying maps are available for
 // use in performance sensitive places that are *already* templatized (for example update_range_value).
 // In STL style.  Note that N must be < uint8_t max
@@ -19,12 +19,14 @@
  * Author: Jeremy Gebben <jeremyg@lunarg.com>
  */
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 #include <memory>
 #include <bitset>
 #include "synchronization_validation.h"
 #include "sync_utils.h"
+#include "layer_options.h"
 
 // Utilities to DRY up Get... calls
 template <typename Map, typename Key = typename Map::key_type, typename RetVal = layer_data::optional<typename Map::mapped_type>>
@@ -248,17 +250,15 @@ std::ostream &operator<<(std::ostream &out, const HazardResult &hazard) {
     const auto *info = SyncStageAccessInfoFromMask(hazard.prior_access);
     const char *stage_access_name = info ? info->name : "INVALID_STAGE_ACCESS";
     out << "(";
-    if (!hazard.recorded_access.get()) {
+    if (!hazard.recorded_access) {
         // if we have a recorded usage the usage is reported from the recorded contexts point of view
         out << "usage: " << usage_info.name << ", ";
     }
     out << "prior_usage: " << stage_access_name;
     if (IsHazardVsRead(hazard.hazard)) {
-        const auto barriers = hazard.access_state->GetReadBarriers(hazard.prior_access);
-        out << ", read_barriers: " << string_VkPipelineStageFlags2KHR(barriers);
+        out << ", read_barriers: " << string_VkPipelineStageFlags2KHR(hazard.read_barriers);
     } else {
-        SyncStageAccessFlags write_barrier = hazard.access_state->GetWriteBarriers();
-        out << ", write_barriers: " << string_SyncStageAccessFlags(write_barrier);
+        out << ", write_barriers: " << string_SyncStageAccessFlags(hazard.write_barriers);
     }
     return out;
 }
@@ -269,6 +269,27 @@ struct NoopBarrierAction {
     const bool layout_transition = false;
 };
 
+CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator *sync_validator)
+    : CommandExecutionContext(sync_validator),
+      cb_state_(),
+      queue_flags_(),
+      destroyed_(false),
+      access_log_(),
+      cbs_referenced_(),
+      command_number_(0),
+      subcommand_number_(0),
+      reset_count_(0),
+      cb_access_context_(),
+      current_context_(&cb_access_context_),
+      events_context_(),
+      render_pass_contexts_(),
+      current_renderpass_context_(),
+      sync_ops_() {
+    if (sync_validator) {
+        cb_access_context_.SetStats(sync_validator->GetStats());
+    }
+}
+
 // NOTE: Make sure the proxy doesn't outlive from, as the proxy is pointing directly to access contexts owned by from.
 CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccessContext &from, AsProxyContext dummy)
     : CommandBufferAccessContext(from.sync_state_) {
@@ -587,7 +608,7 @@ class FilteredGeneratorGenerator {
     KeyType current_;
 };
 
-using EventImageRangeGenerator = FilteredGeneratorGenerator<SyncEventState::ScopeMap, subresource_adapter::ImageRangeGenerator>;
+using EventImageRangeGenerator = FilteredGeneratorGenerator<SyncEventState::ScopeMap, subresource_adapter::RangeListGenerator>;
 
 
 ResourceAccessRange GetBufferRange(VkDeviceSize offset, VkDeviceSize buf_whole_size, uint32_t first_index, uint32_t count,
@@ -776,16 +797,19 @@ class UpdateStateResolveAction {
 
 void HazardResult::Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
                        const SyncStageAccessFlags &prior_, const ResourceUsageTag tag_) {
-    access_state = layer_data::make_unique<const ResourceAccessState>(*access_state_);
     usage_index = usage_index_;
     hazard = hazard_;
     prior_access = prior_;
     tag = tag_;
+    // Capture only the barrier state the report needs, rather than a copy of the whole access state
+    if (IsHazardVsRead(hazard_)) {
+        read_barriers = access_state_->GetReadBarriers(prior_);
+    } else {
+        write_barriers = access_state_->GetWriteBarriers();
+    }
 }
 
-void HazardResult::AddRecordedAccess(const ResourceFirstAccess &first_access) {
-    recorded_access = layer_data::make_unique<const ResourceFirstAccess>(first_access);
-}
+void HazardResult::AddRecordedAccess(const ResourceFirstAccess &first_access) { recorded_access.emplace(first_access); }
 
 void AccessContext::DeleteAccess(const AddressRange &address) { GetAccessStateMap(address.type).erase_range(address.range); }
 
@@ -793,6 +817,9 @@ AccessContext::AccessContext(uint32_t subpass, VkQueueFlags queue_flags,
                              const std::vector<SubpassDependencyGraphNode> &dependencies,
                              const std::vector<AccessContext> &contexts, const AccessContext *external_context) {
     Reset();
+    if (external_context) {
+        stats_ = external_context->GetStats();
+    }
     const auto &subpass_dep = dependencies[subpass];
     bool has_barrier_from_external = subpass_dep.barrier_from_external.size() > 0U;
     prev_.reserve(subpass_dep.prev.size() + (has_barrier_from_external ? 1U : 0U));
@@ -842,12 +869,29 @@ void AccessContext::ForAll(Action &&action) {
     }
 }
 
+void AccessContext::Consolidate() {
+    for (auto &map : access_state_maps_) {
+        sparse_container::consolidate(map);
+    }
+}
+
+void AccessContext::GatherReferencedTags(ResourceUsageTagSet &used) const {
+    for (const auto address_type : kAddressTypes) {
+        for (const auto &access : GetAccessStateMap(address_type)) {
+            access.second.GatherReferencedTags(used);
+        }
+    }
+}
+
 // A recursive range walker for hazard detection, first for the current context and the (DetectHazardRecur) to walk
 // the DAG of the contexts (for example subpasses)
 template <typename Detector>
 HazardResult AccessContext::DetectHazard(AccessAddressType type, Detector &detector, const ResourceAccessRange &range,
                                          DetectOptions options) const {
     HazardResult hazard;
+    if (stats_) {
+        stats_->Add(stats_->hazard_checks);
+    }
 
     if (static_cast<uint32_t>(options) & DetectOptions::kDetectAsync) {
         // Async checks don't require recursive lookups, as the async lists are exhaustive for the top-level context
@@ -1124,13 +1168,12 @@ template <typename BarrierAction>
 void AccessContext::ResolveAccessRange(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                                        BarrierAction &barrier_action, ResourceAccessRangeMap *descent_map,
                                        const ResourceAccessState *infill_state) const {
-    const auto *attachment_gen = view_gen.GetRangeGen(gen_type);
-    if (!attachment_gen) return;
+    const auto *attachment_ranges = view_gen.GetRanges(gen_type);
+    if (!attachment_ranges) return;
 
-    subresource_adapter::ImageRangeGenerator range_gen(*attachment_gen);
     const AccessAddressType address_type = view_gen.GetAddressType();
-    for (; range_gen->non_empty(); ++range_gen) {
-        ResolveAccessRange(address_type, *range_gen, barrier_action, descent_map, infill_state);
+    for (const auto &range : *attachment_ranges) {
+        ResolveAccessRange(address_type, range, barrier_action, descent_map, infill_state);
     }
 }
 
@@ -1373,13 +1416,12 @@ HazardResult AccessContext::DetectHazard(const BUFFER_STATE &buffer, SyncStageAc
 template <typename Detector>
 HazardResult AccessContext::DetectHazard(Detector &detector, const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                                          DetectOptions options) const {
-    const auto *attachment_gen = view_gen.GetRangeGen(gen_type);
-    if (!attachment_gen) return HazardResult();
+    const auto *attachment_ranges = view_gen.GetRanges(gen_type);
+    if (!attachment_ranges) return HazardResult();
 
-    subresource_adapter::ImageRangeGenerator range_gen(*attachment_gen);
     const auto address_type = view_gen.GetAddressType();
-    for (; range_gen->non_empty(); ++range_gen) {
-        HazardResult hazard = DetectHazard(address_type, detector, *range_gen, options);
+    for (const auto &range : *attachment_ranges) {
+        HazardResult hazard = DetectHazard(address_type, detector, range, options);
         if (hazard.hazard) return hazard;
     }
 
@@ -1407,8 +1449,7 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const IMAGE_STATE &
                                          DetectOptions options) const {
     if (!SimpleBinding(image)) return HazardResult();
     const auto base_address = ResourceBaseAddress(image);
-    subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, base_address,
-                                                       is_depth_sliced);
+    auto range_gen = image.fragment_encoder->MakeRangeListGenerator(subresource_range, base_address, is_depth_sliced);
     const auto address_type = ImageAddressType(image);
     for (; range_gen->non_empty(); ++range_gen) {
         HazardResult hazard = DetectHazard(address_type, detector, *range_gen, options);
@@ -1438,6 +1479,20 @@ HazardResult AccessContext::DetectHazard(const AttachmentViewGen &view_gen, Atta
     return DetectHazard(detector, view_gen, gen_type, DetectOptions::kDetectAll);
 }
 
+HazardResult AccessContext::DetectHazard(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage,
+                                         bool is_depth_sliced) const {
+    const IMAGE_STATE &image = *view.image_state;
+    if (!SimpleBinding(image)) return HazardResult();
+    HazardDetector detector(current_usage);
+    subresource_adapter::RangeListGenerator range_gen(view.GetFragmentRanges(is_depth_sliced), ResourceBaseAddress(image));
+    const auto address_type = ImageAddressType(image);
+    for (; range_gen->non_empty(); ++range_gen) {
+        HazardResult hazard = DetectHazard(address_type, detector, *range_gen, DetectOptions::kDetectAll);
+        if (hazard.hazard) return hazard;
+    }
+    return HazardResult();
+}
+
 HazardResult AccessContext::DetectHazard(const IMAGE_STATE &image, SyncStageAccessIndex current_usage,
                                          const VkImageSubresourceRange &subresource_range, SyncOrdering ordering_rule,
                                          const VkOffset3D &offset, const VkExtent3D &extent, bool is_depth_sliced) const {
@@ -1801,7 +1856,9 @@ class ResolvePendingBarrierFunctor : public ApplyBarrierOpsFunctor<NoopBarrierAc
 void AccessContext::UpdateAccessState(AccessAddressType type, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                                       const ResourceAccessRange &range, const ResourceUsageTag tag) {
     UpdateMemoryAccessStateFunctor action(type, *this, current_usage, ordering_rule, tag);
-    UpdateMemoryAccessState(&GetAccessStateMap(type), range, action);
+    // The range is known, so only the coalesced reads overlapping it need to be dropped
+    if (type == AccessAddressType::kLinear) coalesced_reads_.Invalidate(range);
+    UpdateMemoryAccessState(&access_state_maps_[static_cast<size_t>(type)], range, action);
 }
 
 void AccessContext::UpdateAccessState(const BUFFER_STATE &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -1811,11 +1868,67 @@ void AccessContext::UpdateAccessState(const BUFFER_STATE &buffer, SyncStageAcces
     UpdateAccessState(AccessAddressType::kLinear, current_usage, ordering_rule, range + base_address, tag);
 }
 
+bool AccessContext::IsCoalescedRead(const BUFFER_STATE &buffer, SyncStageAccessIndex read_index,
+                                    const ResourceAccessRange &range) const {
+    if (!SimpleBinding(buffer)) return false;
+    return coalesced_reads_.Contains(read_index, range + ResourceBaseAddress(buffer));
+}
+
+void AccessContext::UpdateCoalescedReadState(const BUFFER_STATE &buffer, SyncStageAccessIndex read_index,
+                                             const ResourceAccessRange &range, const ResourceUsageTag tag) {
+    assert(SyncStageAccess::IsRead(read_index));
+    if (!SimpleBinding(buffer)) return;
+    const ResourceAccessRange address_range = range + ResourceBaseAddress(buffer);
+    if (coalesced_reads_.Contains(read_index, address_range)) return;
+
+    UpdateAccessState(AccessAddressType::kLinear, read_index, SyncOrdering::kNonAttachment, address_range, tag);
+    // Hazards are reported for every command, so only a hazard free read can stand in for the ones repeating it
+    if (address_range.non_empty() && !DetectHazard(buffer, read_index, range).hazard) {
+        coalesced_reads_.Insert(read_index, address_range);
+    }
+}
+
+bool AccessContext::CoalescedReads::Contains(SyncStageAccessIndex read_index, const ResourceAccessRange &range) const {
+    for (size_t i = 0; i < size_; ++i) {
+        if ((reads_[i].read_index == read_index) && reads_[i].range.includes(range)) return true;
+    }
+    return false;
+}
+
+void AccessContext::CoalescedReads::Insert(SyncStageAccessIndex read_index, const ResourceAccessRange &range) {
+    if (size_ < kMaxReads) {
+        reads_[size_++] = Read{read_index, range};
+    } else {
+        reads_[next_replace_] = Read{read_index, range};
+        next_replace_ = (next_replace_ + 1) % kMaxReads;
+    }
+}
+
+void AccessContext::CoalescedReads::Invalidate(const ResourceAccessRange &range) {
+    size_t i = 0;
+    while (i < size_) {
+        if (reads_[i].range.intersects(range)) {
+            reads_[i] = reads_[--size_];
+        } else {
+            ++i;
+        }
+    }
+}
+
 void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                                       const VkImageSubresourceRange &subresource_range, const ResourceUsageTag &tag) {
     if (!SimpleBinding(image)) return;
     const auto base_address = ResourceBaseAddress(image);
-    subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, base_address, false);
+    auto range_gen = image.fragment_encoder->MakeRangeListGenerator(subresource_range, base_address, false);
+    const auto address_type = ImageAddressType(image);
+    UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
+    UpdateMemoryAccessState(&GetAccessStateMap(address_type), action, &range_gen);
+}
+void AccessContext::UpdateAccessState(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
+                                      bool is_depth_sliced, ResourceUsageTag tag) {
+    const IMAGE_STATE &image = *view.image_state;
+    if (!SimpleBinding(image)) return;
+    subresource_adapter::RangeListGenerator range_gen(view.GetFragmentRanges(is_depth_sliced), ResourceBaseAddress(image));
     const auto address_type = ImageAddressType(image);
     UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
     UpdateMemoryAccessState(&GetAccessStateMap(address_type), action, &range_gen);
@@ -1834,12 +1947,14 @@ void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessI
 
 void AccessContext::UpdateAccessState(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                                       SyncStageAccessIndex current_usage, SyncOrdering ordering_rule, const ResourceUsageTag tag) {
-    const ImageRangeGen *gen = view_gen.GetRangeGen(gen_type);
-    if (!gen) return;
-    subresource_adapter::ImageRangeGenerator range_gen(*gen);
+    const auto *ranges = view_gen.GetRanges(gen_type);
+    if (!ranges) return;
     const auto address_type = view_gen.GetAddressType();
     UpdateMemoryAccessStateFunctor action(address_type, *this, current_usage, ordering_rule, tag);
-    ApplyUpdateAction(address_type, action, &range_gen);
+    auto *accesses = &GetAccessStateMap(address_type);
+    for (const auto &range : *ranges) {
+        UpdateMemoryAccessState(accesses, range, action);
+    }
 }
 
 void AccessContext::UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -1858,9 +1973,12 @@ void AccessContext::ApplyUpdateAction(AccessAddressType address_type, const Acti
 
 template <typename Action>
 void AccessContext::ApplyUpdateAction(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type, const Action &action) {
-    const ImageRangeGen *gen = view_gen.GetRangeGen(gen_type);
-    if (!gen) return;
-    UpdateMemoryAccessState(&GetAccessStateMap(view_gen.GetAddressType()), action, *gen);
+    const auto *ranges = view_gen.GetRanges(gen_type);
+    if (!ranges) return;
+    auto *accesses = &GetAccessStateMap(view_gen.GetAddressType());
+    for (const auto &range : *ranges) {
+        UpdateMemoryAccessState(accesses, range, action);
+    }
 }
 
 void AccessContext::UpdateAttachmentResolveAccess(const RENDER_PASS_STATE &rp_state,
@@ -1903,6 +2021,12 @@ void AccessContext::UpdateAttachmentStoreAccess(const RENDER_PASS_STATE &rp_stat
     }
 }
 
+void AccessContext::CountBarrierApplications(uint64_t count) const {
+    if (stats_) {
+        stats_->Add(stats_->barrier_applications, count);
+    }
+}
+
 template <typename Action>
 void AccessContext::ApplyToContext(const Action &barrier_action) {
     // Note: Barriers do *not* cross context boundaries, applying to accessess within.... (at least for renderpass subpasses)
@@ -1915,6 +2039,7 @@ void AccessContext::ResolveChildContexts(const std::vector<AccessContext> &conte
     for (uint32_t subpass_index = 0; subpass_index < contexts.size(); subpass_index++) {
         auto &context = contexts[subpass_index];
         ApplyTrackbackStackAction barrier_action(context.GetDstExternalTrackBack().barriers);
+        CountBarrierApplications(context.GetDstExternalTrackBack().barriers.size());
         for (const auto address_type : kAddressTypes) {
             context.ResolveAccessRange(address_type, kFullRange, barrier_action, &GetAccessStateMap(address_type), nullptr, false);
         }
@@ -1961,6 +2086,7 @@ void AccessContext::RecordLayoutTransitions(const RENDER_PASS_STATE &rp_state, u
         const auto address_type = view_gen.GetAddressType();
         auto &target_map = GetAccessStateMap(address_type);
         ApplySubpassTransitionBarriersAction barrier_action(trackback->barriers);
+        CountBarrierApplications(trackback->barriers.size());
         prev_context->ResolveAccessRange(view_gen, AttachmentViewGen::Gen::kViewSubresource, barrier_action, &target_map,
                                          &empty_infill);
     }
@@ -2029,8 +2155,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                                 current_context_->DetectHazard(*img_state, sync_index, subresource_range, SyncOrdering::kRaster,
                                                                offset, extent, img_view_state->IsDepthSliced());
                         } else {
-                            hazard = current_context_->DetectHazard(*img_state, sync_index, subresource_range,
-                                                                    img_view_state->IsDepthSliced());
+                            hazard = current_context_->DetectHazard(*img_view_state, sync_index, img_view_state->IsDepthSliced());
                         }
 
                         if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
@@ -2152,8 +2277,9 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                             current_context_->UpdateAccessState(*img_state, sync_index, SyncOrdering::kRaster,
                                                                 img_view_state->normalized_subresource_range, offset, extent, tag);
                         } else {
-                            current_context_->UpdateAccessState(*img_state, sync_index, SyncOrdering::kNonAttachment,
-                                                                img_view_state->normalized_subresource_range, tag);
+                            // Recorded over the full depth range (not depth sliced), as before ranges were memoized
+                            current_context_->UpdateAccessState(*img_view_state, sync_index, SyncOrdering::kNonAttachment, false,
+                                                                tag);
                         }
                         break;
                     }
@@ -2208,6 +2334,7 @@ bool CommandBufferAccessContext::ValidateDrawVertex(uint32_t vertexCount, uint32
             auto *buf_state = binding_buffer.buffer_state.get();
             const ResourceAccessRange range = GetBufferRange(binding_buffer.offset, buf_state->createInfo.size, firstVertex,
                                                              vertexCount, binding_description.stride);
+            if (current_context_->IsCoalescedRead(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range)) continue;
             auto hazard = current_context_->DetectHazard(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range);
             if (hazard.hazard) {
                 skip |= sync_state_->LogError(
@@ -2239,8 +2366,7 @@ void CommandBufferAccessContext::RecordDrawVertex(uint32_t vertexCount, uint32_t
             auto *buf_state = binding_buffer.buffer_state.get();
             const ResourceAccessRange range = GetBufferRange(binding_buffer.offset, buf_state->createInfo.size, firstVertex,
                                                              vertexCount, binding_description.stride);
-            current_context_->UpdateAccessState(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ,
-                                                SyncOrdering::kNonAttachment, range, tag);
+            current_context_->UpdateCoalescedReadState(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range, tag);
         }
     }
 }
@@ -2255,7 +2381,10 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(uint32_t indexCount, ui
     const auto index_size = GetIndexAlignment(cb_state_->index_buffer_binding.index_type);
     const ResourceAccessRange range = GetBufferRange(cb_state_->index_buffer_binding.offset, index_buf_state->createInfo.size,
                                                      firstIndex, indexCount, index_size);
-    auto hazard = current_context_->DetectHazard(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, range);
+    HazardResult hazard;
+    if (!current_context_->IsCoalescedRead(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, range)) {
+        hazard = current_context_->DetectHazard(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, range);
+    }
     if (hazard.hazard) {
         skip |= sync_state_->LogError(
             index_buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), "%s: Hazard %s for index %s in %s. Access info %s.",
@@ -2277,7 +2406,7 @@ void CommandBufferAccessContext::RecordDrawVertexIndex(uint32_t indexCount, uint
     const auto index_size = GetIndexAlignment(cb_state_->index_buffer_binding.index_type);
     const ResourceAccessRange range = GetBufferRange(cb_state_->index_buffer_binding.offset, index_buf_state->createInfo.size,
                                                      firstIndex, indexCount, index_size);
-    current_context_->UpdateAccessState(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, SyncOrdering::kNonAttachment, range, tag);
+    current_context_->UpdateCoalescedReadState(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, range, tag);
 
     // TODO: For now, we detect the whole vertex buffer. Index buffer could be changed until SubmitQueue.
     //       We will detect more accurate range in the future.
@@ -2338,14 +2467,6 @@ ResourceUsageTag CommandBufferAccessContext::RecordEndRenderPass(const CMD_TYPE
     return barrier_tag;
 }
 
-void CommandBufferAccessContext::RecordDestroyEvent(VkEvent event) {
-    // Erase is okay with the key not being
-    auto event_state = sync_state_->Get<EVENT_STATE>(event);
-    if (event_state) {
-        GetCurrentEventsContext()->Destroy(event_state.get());
-    }
-}
-
 // The is the recorded cb context
 bool CommandBufferAccessContext::ValidateFirstUse(CommandExecutionContext *proxy_context, const char *func_name,
                                                   uint32_t index) const {
@@ -2446,6 +2567,7 @@ ResourceUsageTag CommandBufferAccessContext::NextSubcommandTag(CMD_TYPE command,
 }
 
 ResourceUsageTag CommandBufferAccessContext::NextCommandTag(CMD_TYPE command, ResourceUsageRecord::SubcommandType subcommand) {
+    sync_state_->GetStats()->Add(sync_state_->GetStats()->commands);
     command_number_++;
     subcommand_number_ = 0;
     ResourceUsageTag next = access_log_.size();
@@ -2461,6 +2583,9 @@ ResourceUsageTag CommandBufferAccessContext::NextIndexedCommandTag(CMD_TYPE comm
 }
 
 void CommandBufferAccessContext::RecordSyncOp(SyncOpPointer &&sync_op) {
+    // Even those not touching the access state (e.g. SetEvent) depend on the tags of prior accesses, so the next read must
+    // record its own tag.
+    current_context_->ClearCoalescedReads();
     auto tag = sync_op->Record(this);
     // As renderpass operations can have side effects on the command buffer access context,
     // update the sync operation to record these if any.
@@ -3001,7 +3126,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
         if (last_reads.size()) {
             for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.Access(), read_access.tag);
                     break;
                 }
             }
@@ -3064,7 +3189,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
                 for (const auto &read_access : last_reads) {
                     if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
                     if (IsReadHazard(usage_stage, read_access)) {
-                        hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                        hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.Access(), read_access.tag);
                         break;
                     }
                 }
@@ -3158,7 +3283,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
             for (const auto &read_access : last_reads) {
                 if (read_access.tag >= start_tag) {
-                    hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.Access(), read_access.tag);
                     break;
                 }
             }
@@ -3196,7 +3321,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
         // Look at the reads if any
         for (const auto &read_access : last_reads) {
             if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope)) {
-                hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.Access(), read_access.tag);
                 break;
             }
         }
@@ -3236,21 +3361,21 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.access, current_read.tag);
+                    hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.Access(), current_read.tag);
                 } else {
                     // The read is in the events first synchronization scope, so we use a barrier hazard check
                     // If the read stage is not in the src sync scope
                     // *AND* not execution chained with an existing sync barrier (that's the or)
                     // then the barrier access is unsafe (R/W after R)
                     if (scope_read.IsReadBarrierHazard(event_queue, src_exec_scope)) {
-                        hazard.Set(this, usage_index, WRITE_AFTER_READ, scope_read.access, scope_read.tag);
+                        hazard.Set(this, usage_index, WRITE_AFTER_READ, scope_read.Access(), scope_read.tag);
                         break;
                     }
                 }
             }
             if (!hazard.IsHazard() && (last_reads.size() > scope_read_count)) {
                 const ReadState &current_read = last_reads[scope_read_count];
-                hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.access, current_read.tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.Access(), current_read.tag);
             }
         } else if (last_write.any()) {
             // if there are no reads, the write is either the reason the access is in the event scope... they are a hazard
@@ -3296,7 +3421,7 @@ void ResourceAccessState::Resolve(const ResourceAccessState &other) {
                     if (other_read.stage == my_read.stage) {
                         if (my_read.tag < other_read.tag) {
                             // Other is more recent, copy in the state
-                            my_read.access = other_read.access;
+                            my_read.access_index = other_read.access_index;
                             my_read.tag = other_read.tag;
                             my_read.queue = other_read.queue;
                             my_read.pending_dep_chain = other_read.pending_dep_chain;
@@ -3367,7 +3492,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
             const auto not_usage_stage = ~usage_stage;
             for (auto &read_access : last_reads) {
                 if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag);
+                    read_access.Set(usage_stage, usage_index, 0, tag);
                 } else if (read_access.barriers & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
                     read_access.sync_stages |= usage_stage;
@@ -3384,7 +3509,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
+            last_reads.emplace_back(usage_stage, usage_index, 0, tag);
             last_read_stages |= usage_stage;
         }
 
@@ -3600,6 +3725,18 @@ bool ResourceAccessState::FirstAccessInTagRange(const ResourceUsageRange &tag_ra
     return tag_range.intersects(first_access_range);
 }
 
+void ResourceAccessState::GatherReferencedTags(ResourceUsageTagSet &used) const {
+    if (last_write.any()) {
+        used.insert(write_tag);
+    }
+    for (const auto &read_access : last_reads) {
+        used.insert(read_access.tag);
+    }
+    for (const auto &first : first_accesses_) {
+        used.insert(first.tag);
+    }
+}
+
 void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     if (last_write.any()) write_tag += offset;
     for (auto &read_access : last_reads) {
@@ -3612,27 +3749,28 @@ void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
 
 ResourceAccessState::ResourceAccessState()
     : write_barriers(~SyncStageAccessFlags(0)),
+      last_write(0),
+      pending_write_barriers(0),
       write_dependency_chain(0),
       write_tag(),
-      write_queue(QueueSyncState::kQueueIdInvalid),
-      last_write(0),
-      input_attachment_read(false),
       last_read_stages(0),
       read_execution_barriers(0),
       pending_write_dep_chain(0),
+      first_read_stages_(0U),
+      write_queue(QueueSyncState::kQueueIdInvalid),
+      input_attachment_read(false),
       pending_layout_transition(false),
-      pending_write_barriers(0),
+      last_reads(),
       pending_layout_ordering_(),
-      first_accesses_(),
-      first_read_stages_(0U),
-      first_write_layout_ordering_() {}
+      first_write_layout_ordering_(),
+      first_accesses_() {}
 
 // This should be just Bits or Index, but we don't have an invalid state for Index
 VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = 0U;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if ((read_access.Access() & usage_bit).any()) {
             barriers = read_access.barriers;
             break;
         }
@@ -3746,20 +3884,20 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
-ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_,
+ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                           VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_)
     : stage(stage_),
-      access(access_),
       barriers(barriers_),
       sync_stages(VK_PIPELINE_STAGE_2_NONE),
+      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE),
       tag(tag_),
-      queue(QueueSyncState::kQueueIdInvalid),
-      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE) {}
+      access_index(access_index_),
+      queue(QueueSyncState::kQueueIdInvalid) {}
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_) {
     stage = stage_;
-    access = access_;
+    access_index = access_index_;
     barriers = barriers_;
     sync_stages = VK_PIPELINE_STAGE_2_NONE;
     tag = tag_;
@@ -3774,6 +3912,22 @@ bool ResourceAccessState::ReadState::ReadInQueueScopeOrChain(QueueId scope_queue
     return (exec_scope & effective_stages) != 0;
 }
 
+ReadLockGuard SyncValidator::ReadLock() {
+    if (fine_grained_locking) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLockGuard(validation_object_mutex);
+    }
+}
+
+WriteLockGuard SyncValidator::WriteLock() {
+    if (fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLockGuard(validation_object_mutex);
+    }
+}
+
 ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const {
     ResourceUsageRange reserve;
     reserve.begin = tag_limit_.fetch_add(tag_count);
@@ -3839,6 +3993,8 @@ QueueBatchContext::BatchSet SyncValidator::GetQueueBatchSnapshot() {
         return false;
     };
     GetQueueBatchSnapshotImpl<QueueBatchContext::BatchSet>(signaled_semaphores_, append);
+    signaled_semaphores_.ForEachTimelineSignal(
+        [&append](const std::shared_ptr<SignaledSemaphores::Signal> &signal) { append(signal->batch); });
     return snapshot;
 }
 
@@ -3849,6 +4005,17 @@ bool SignaledSemaphores::SignalSemaphore(const std::shared_ptr<const SEMAPHORE_S
     const SyncExecScope exec_scope =
         SyncExecScope::MakeSrc(batch->GetQueueFlags(), signal_info.stageMask, VK_PIPELINE_STAGE_2_HOST_BIT);
     const VkSemaphore sem = sem_state->semaphore();
+    if (sem_state->type == VK_SEMAPHORE_TYPE_TIMELINE) {
+        // Earlier signals are kept, as waits for smaller values must resolve against the batch that reached them first
+        auto signal = std::make_shared<Signal>(sem_state, batch, exec_scope, signal_info.value);
+        const bool success = GetTimeline(sem).signals.emplace(signal_info.value, signal).second;
+        // A repeated payload is an invalid signal, which CoreChecks reports
+        if (success) {
+            new_timeline_signals_.emplace_back(std::move(signal));
+        }
+        return success;
+    }
+
     auto signal_it = signaled_.find(sem);
     std::shared_ptr<Signal> insert_signal;
     if (signal_it == signaled_.end()) {
@@ -3865,7 +4032,7 @@ bool SignaledSemaphores::SignalSemaphore(const std::shared_ptr<const SEMAPHORE_S
 
     bool success = false;
     if (!signal_it->second) {
-        signal_it->second = std::make_shared<Signal>(sem_state, batch, exec_scope);
+        signal_it->second = std::make_shared<Signal>(sem_state, batch, exec_scope, signal_info.value);
         success = true;
     }
 
@@ -3897,6 +4064,63 @@ std::shared_ptr<const SignaledSemaphores::Signal> SignaledSemaphores::Unsignal(V
     return unsignaled;
 }
 
+std::shared_ptr<const SignaledSemaphores::Signal> SignaledSemaphores::WaitTimeline(VkSemaphore sem, QueueId queue, uint64_t value,
+                                                                                  size_t queue_count) {
+    Timeline &timeline = GetTimeline(sem);
+
+    // The wait is satisfied by the first signal reaching its value, i.e. the smallest payload not less than the wait value.
+    // If there is none, the wait is for a signal not yet submitted (or signaled from the host), which isn't tracked.
+    std::shared_ptr<const Signal> signal;
+    const auto signal_it = timeline.signals.lower_bound(value);
+    if (signal_it != timeline.signals.end()) {
+        signal = signal_it->second;
+    }
+
+    auto &waited = timeline.waited[queue];
+    waited = std::max(waited, value);
+
+    // Only the signals below the value every queue of the device has waited for can be dropped, as a queue that hasn't waited
+    // yet may still wait for any earlier value. The first signal at or above it is kept, as it is still the one to satisfy
+    // later waits for smaller values.
+    if (timeline.waited.size() < queue_count) {
+        return signal;
+    }
+    uint64_t min_waited = waited;
+    for (const auto &queue_waited : timeline.waited) {
+        min_waited = std::min(min_waited, queue_waited.second);
+    }
+    timeline.signals.erase(timeline.signals.begin(), timeline.signals.lower_bound(min_waited));
+
+    return signal;
+}
+
+void SignaledSemaphores::DropCompletedTimelineSignals() {
+    // With every queue idle, the batches of all signals have had their accesses waited for. The last signal of each timeline
+    // is enough to still resolve any wait for a value up to its payload.
+    for (auto &timeline : timelines_) {
+        auto &signals = timeline.second.signals;
+        if (signals.size() > 1) {
+            signals.erase(signals.begin(), std::prev(signals.end()));
+        }
+    }
+}
+
+SignaledSemaphores::Timeline &SignaledSemaphores::GetTimeline(VkSemaphore sem) {
+    auto found_it = timelines_.find(sem);
+    if (found_it == timelines_.end()) {
+        Timeline timeline;
+        if (prev_) {
+            // Copy the prev state on first use, as prev_ is const
+            const auto prev_it = prev_->timelines_.find(sem);
+            if (prev_it != prev_->timelines_.cend()) {
+                timeline = prev_it->second;
+            }
+        }
+        found_it = timelines_.emplace(sem, std::move(timeline)).first;
+    }
+    return found_it->second;
+}
+
 void SignaledSemaphores::Import(VkSemaphore sem, std::shared_ptr<Signal> &&from) {
     // Overwrite the s  tate with the last state from this
     if (from) {
@@ -3907,8 +4131,23 @@ void SignaledSemaphores::Import(VkSemaphore sem, std::shared_ptr<Signal> &&from)
     }
 }
 
+void SignaledSemaphores::ImportTimeline(VkSemaphore sem, Timeline &&from) {
+    if (from.signals.empty() && from.waited.empty()) {
+        timelines_.erase(sem);
+    } else {
+        timelines_[sem] = std::move(from);
+    }
+}
+
+void SignaledSemaphores::Erase(VkSemaphore sem) {
+    signaled_.erase(sem);
+    timelines_.erase(sem);
+}
+
 void SignaledSemaphores::Reset() {
     signaled_.clear();
+    timelines_.clear();
+    new_timeline_signals_.clear();
     prev_ = nullptr;
 }
 
@@ -3917,19 +4156,34 @@ std::shared_ptr<CommandBufferAccessContext> SyncValidator::AccessContextFactory(
     auto cb_state = Get<CMD_BUFFER_STATE>(command_buffer);
     assert(cb_state.get());
     auto queue_flags = cb_state->GetQueueFlags();
+    // Called with cb_access_state_lock_ held for write
+    if (!cb_access_context_pool_.empty()) {
+        std::shared_ptr<CommandBufferAccessContext> recycled = std::move(cb_access_context_pool_.back());
+        cb_access_context_pool_.pop_back();
+        recycled->Rebind(cb_state, queue_flags);
+        return recycled;
+    }
     return std::make_shared<CommandBufferAccessContext>(*this, cb_state, queue_flags);
 }
 
 std::shared_ptr<CommandBufferAccessContext> SyncValidator::GetAccessContextShared(VkCommandBuffer command_buffer) {
+    {
+        ReadLockGuard lock(cb_access_state_lock_);
+        auto found = cb_access_state.find(command_buffer);
+        if (found != cb_access_state.end()) return found->second;
+    }
+    WriteLockGuard lock(cb_access_state_lock_);
     return GetMappedInsert(cb_access_state, command_buffer,
                            [this, command_buffer]() { return AccessContextFactory(command_buffer); });
 }
 
 std::shared_ptr<const CommandBufferAccessContext> SyncValidator::GetAccessContextShared(VkCommandBuffer command_buffer) const {
+    ReadLockGuard lock(cb_access_state_lock_);
     return GetMapped(cb_access_state, command_buffer, []() { return std::shared_ptr<CommandBufferAccessContext>(); });
 }
 
 const CommandBufferAccessContext *SyncValidator::GetAccessContext(VkCommandBuffer command_buffer) const {
+    ReadLockGuard lock(cb_access_state_lock_);
     return GetMappedPlainFromShared(cb_access_state, command_buffer);
 }
 
@@ -3938,6 +4192,7 @@ CommandBufferAccessContext *SyncValidator::GetAccessContext(VkCommandBuffer comm
 }
 
 CommandBufferAccessContext *SyncValidator::GetAccessContextNoInsert(VkCommandBuffer command_buffer) {
+    ReadLockGuard lock(cb_access_state_lock_);
     return GetMappedPlainFromShared(cb_access_state, command_buffer);
 }
 
@@ -3949,11 +4204,18 @@ void SyncValidator::ResetCommandBufferCallback(VkCommandBuffer command_buffer) {
 }
 
 void SyncValidator::FreeCommandBufferCallback(VkCommandBuffer command_buffer) {
+    WriteLockGuard lock(cb_access_state_lock_);
     auto access_found = cb_access_state.find(command_buffer);
     if (access_found != cb_access_state.end()) {
-        access_found->second->Reset();
-        access_found->second->MarkDestroyed();
+        std::shared_ptr<CommandBufferAccessContext> access_context = std::move(access_found->second);
         cb_access_state.erase(access_found);
+        access_context->Reset();
+        access_context->MarkDestroyed();
+        // Queue batches may still refer to the context (as destroyed), only recycle it if this is the last reference
+        if ((access_context.use_count() == 1) && (cb_access_context_pool_.size() < kMaxPooledAccessContexts)) {
+            access_context->Unbind();
+            cb_access_context_pool_.emplace_back(std::move(access_context));
+        }
     }
 }
 
@@ -4019,13 +4281,6 @@ void SyncValidator::PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, Vk
     }
 }
 
-void SyncValidator::PreCallRecordDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
-    // Clear out events from the command buffer contexts
-    for (auto &cb_context : cb_access_state) {
-        cb_context.second->RecordDestroyEvent(event);
-    }
-}
-
 bool SyncValidator::ValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfos,
                                            CMD_TYPE cmd_type) const {
     bool skip = false;
@@ -4337,6 +4592,45 @@ void SyncValidator::PreCallRecordCmdPipelineBarrier2(VkCommandBuffer commandBuff
                                                            *pDependencyInfo);
 }
 
+void SyncValidator::PostCallRecordCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                                 VkInstance *pInstance, VkResult result) {
+    StateTracker::PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
+    if (VK_SUCCESS != result) return;
+
+    // As with the core layer settings, the settings file and environment take precedence over VkLayerSettingsEXT
+    const auto *layer_settings = FindSettingsInChain(pCreateInfo->pNext);
+    if (layer_settings) {
+        for (uint32_t i = 0; i < layer_settings->settingCount; i++) {
+            const auto &setting = layer_settings->pSettings[i];
+            const std::string name(setting.name);
+            if (name == "syncval_access_log_limit") {
+                access_log_limit_ = (setting.type == VK_LAYER_SETTING_VALUE_TYPE_UINT64_EXT)
+                                        ? static_cast<size_t>(setting.data.value64)
+                                        : static_cast<size_t>(setting.data.value32);
+            } else if (name == "syncval_stats") {
+                report_stats_ = (setting.data.valueBool != VK_FALSE);
+            } else if (name == "syncval_stats_interval") {
+                stats_report_interval_ = (setting.type == VK_LAYER_SETTING_VALUE_TYPE_UINT64_EXT) ? setting.data.value64
+                                                                                                  : setting.data.value32;
+            }
+        }
+    }
+
+    const char *log_limit_string = getLayerOption("khronos_validation.syncval_access_log_limit");
+    if (*log_limit_string) {
+        access_log_limit_ = static_cast<size_t>(std::strtoull(log_limit_string, nullptr, 10));
+    }
+    std::string stats_string = getLayerOption("khronos_validation.syncval_stats");
+    if (stats_string.length()) {
+        transform(stats_string.begin(), stats_string.end(), stats_string.begin(), ::tolower);
+        report_stats_ = !stats_string.compare("true");
+    }
+    const char *stats_interval_string = getLayerOption("khronos_validation.syncval_stats_interval");
+    if (*stats_interval_string) {
+        stats_report_interval_ = std::strtoull(stats_interval_string, nullptr, 10);
+    }
+}
+
 void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo);
@@ -4347,6 +4641,13 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     SetCommandBufferResetCallback([this](VkCommandBuffer command_buffer) -> void { ResetCommandBufferCallback(command_buffer); });
     SetCommandBufferFreeCallback([this](VkCommandBuffer command_buffer) -> void { FreeCommandBufferCallback(command_buffer); });
 
+    const auto *instance_sync = static_cast<const SyncValidator *>(instance_state);
+    access_log_limit_ = instance_sync->access_log_limit_;
+    access_log_trim_threshold_ = access_log_limit_;
+    report_stats_ = instance_sync->report_stats_;
+    stats_report_interval_ = instance_sync->stats_report_interval_;
+    if (report_stats_) stats_.Enable();
+
     QueueId queue_id = QueueSyncState::kQueueIdBase;
     ForEachShared<QUEUE_STATE>([this, &queue_id](const std::shared_ptr<QUEUE_STATE> &queue_state) {
         auto queue_flags = physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags;
@@ -6183,7 +6484,7 @@ struct SyncOpPipelineBarrierFunctorFactory {
     using GlobalBarrierOpFunctor = PipelineBarrierOp;
     using GlobalApplyFunctor = ApplyBarrierOpsFunctor<GlobalBarrierOpFunctor>;
     using BufferRange = ResourceAccessRange;
-    using ImageRange = subresource_adapter::ImageRangeGenerator;
+    using ImageRange = subresource_adapter::RangeListGenerator;
     using GlobalRange = ResourceAccessRange;
 
     ApplyFunctor MakeApplyFunctor(QueueId queue_id, const SyncBarrier &barrier, bool layout_transition) const {
@@ -6202,11 +6503,10 @@ struct SyncOpPipelineBarrierFunctorFactory {
         return (range + base_address);
     }
     ImageRange MakeRangeGen(const IMAGE_STATE &image, const VkImageSubresourceRange &subresource_range) const {
-        if (!SimpleBinding(image)) return subresource_adapter::ImageRangeGenerator();
+        if (!SimpleBinding(image)) return ImageRange();
 
         const auto base_address = ResourceBaseAddress(image);
-        subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, base_address, false);
-        return range_gen;
+        return image.fragment_encoder->MakeRangeListGenerator(subresource_range, base_address, false);
     }
     GlobalRange MakeGlobalRangeGen(AccessAddressType) const { return kFullRange; }
 };
@@ -6214,6 +6514,7 @@ struct SyncOpPipelineBarrierFunctorFactory {
 template <typename Barriers, typename FunctorFactory>
 void SyncOpBarriers::ApplyBarriers(const Barriers &barriers, const FunctorFactory &factory, const QueueId queue_id,
                                    const ResourceUsageTag tag, AccessContext *context) {
+    uint64_t applied = 0;
     for (const auto &barrier : barriers) {
         const auto *state = barrier.GetState();
         if (state) {
@@ -6221,8 +6522,10 @@ void SyncOpBarriers::ApplyBarriers(const Barriers &barriers, const FunctorFactor
             auto update_action = factory.MakeApplyFunctor(queue_id, barrier.barrier, barrier.IsLayoutTransition());
             auto range_gen = factory.MakeRangeGen(*state, barrier.Range());
             UpdateMemoryAccessState(accesses, update_action, &range_gen);
+            ++applied;
         }
     }
+    context->CountBarrierApplications(applied);
 }
 
 template <typename Barriers, typename FunctorFactory>
@@ -6232,6 +6535,7 @@ void SyncOpBarriers::ApplyGlobalBarriers(const Barriers &barriers, const Functor
     for (const auto &barrier : barriers) {
         barriers_functor.EmplaceBack(factory.MakeGlobalBarrierOpFunctor(queue_id, barrier));
     }
+    access_context->CountBarrierApplications(barriers.size());
     for (const auto address_type : kAddressTypes) {
         auto range_gen = factory.MakeGlobalRangeGen(address_type);
         UpdateMemoryAccessState(&(access_context->GetAccessStateMap(address_type)), barriers_functor, &range_gen);
@@ -6620,8 +6924,7 @@ struct SyncOpWaitEventsFunctorFactory {
         if (!SimpleBinding(image)) return ImageRange();
         const auto address_type = GetAccessAddressType(image);
         const auto base_address = ResourceBaseAddress(image);
-        subresource_adapter::ImageRangeGenerator image_range_gen(*image.fragment_encoder.get(), subresource_range, base_address,
-                                                                 false);
+        auto image_range_gen = image.fragment_encoder->MakeRangeListGenerator(subresource_range, base_address, false);
         EventImageRangeGenerator filtered_range_gen(sync_event->FirstScope(address_type), image_range_gen);
 
         return filtered_range_gen;
@@ -6653,6 +6956,7 @@ void SyncOpWaitEvents::ReplayRecord(QueueId queue_id, ResourceUsageTag tag, Acce
     // all accesses. Can instead import for all first_scopes, or a union of them, if this becomes a performance/memory issue,
     // but with no idea of the performance of the union, nor of whether it even matters... take the simplest approach here,
     access_context->ResolvePreviousAccesses();
+    events_context->RemoveDestroyed();
 
     size_t barrier_set_index = 0;
     size_t barrier_set_incr = (barriers_.size() == 1) ? 0 : 1;
@@ -7168,6 +7472,8 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result)
     if (!queue_state) return;  // Invalid queue
     QueueId waited_queue = queue_state->GetQueueId();
 
+    WriteLockGuard lock(queue_sync_lock_);
+
     // We need to go through every queue batch context and clear all accesses this wait synchronizes
     // As usual -- two groups, the "last batch" and the signaled semaphores
     // NOTE: Since ApplyTaggedWait crawls through every usage in every ResourceAccessState in the AccessContext of *every*
@@ -7176,6 +7482,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result)
     for (auto &batch : queue_batch_contexts) {
         batch->ApplyTaggedWait(waited_queue, ResourceUsageRecord::kMaxIndex);
     }
+    TrimAccessLog();
 
     // TODO: Fences affected by Wait
 }
@@ -7183,12 +7490,147 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result)
 void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
     StateTracker::PostCallRecordDeviceWaitIdle(device, result);
 
-    QueueBatchContext::BatchSet queue_batch_contexts = GetQueueBatchSnapshot();
-    for (auto &batch : queue_batch_contexts) {
-        batch->ApplyDeviceWait();
+    {
+        WriteLockGuard lock(queue_sync_lock_);
+        QueueBatchContext::BatchSet queue_batch_contexts = GetQueueBatchSnapshot();
+        for (auto &batch : queue_batch_contexts) {
+            batch->ApplyDeviceWait();
+        }
+        // Waiting for the device is the one point where timeline signals not yet waited past by every queue can be dropped
+        signaled_semaphores_.DropCompletedTimelineSignals();
+        TrimAccessLog();
     }
 
     // TODO: Update Fences affected by Wait
+
+    // Other threads may still be recording, so only the submitted state is sampled here
+    if (report_stats_) ReportStats(false);
+}
+
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    if (report_stats_) ReportStats(true);
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
+}
+
+void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore,
+                                                  const VkAllocationCallbacks *pAllocator) {
+    {
+        // Pending signals can no longer be waited on, so don't let them conserve their QueueBatchContexts
+        WriteLockGuard lock(queue_sync_lock_);
+        signaled_semaphores_.Erase(semaphore);
+    }
+    StateTracker::PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
+}
+
+namespace {
+struct ResourceStats {
+    VulkanTypedHandle handle;
+    AccessAddressType address_type;
+    ResourceAccessRange range;
+    size_t entry_count;
+};
+}  // namespace
+
+// The contents of a CommandBufferAccessContext are only covered by the application's external synchronization of its command
+// buffer, so command buffer contexts can only be sampled when no other thread may be recording, i.e. at vkDestroyDevice
+void SyncValidator::ReportStats(bool include_command_buffers) {
+    // Same lock order as queue submit validation
+    WriteLockGuard queue_lock(queue_sync_lock_);
+    ReadLockGuard cb_lock(cb_access_state_lock_);
+
+    std::vector<const AccessContext *> contexts;
+    size_t cb_log_bytes = 0;
+    if (include_command_buffers) {
+        for (const auto &cb_entry : cb_access_state) {
+            const CommandBufferAccessContext &cb_context = *cb_entry.second;
+            cb_context.ForEachAccessContext([&contexts](const AccessContext &context) { contexts.emplace_back(&context); });
+            cb_log_bytes += cb_context.GetAccessLog().capacity() * sizeof(ResourceUsageRecord);
+        }
+    }
+    const size_t cb_context_count = contexts.size();
+
+    const QueueBatchContext::BatchSet batches = GetQueueBatchSnapshot();
+    for (const auto &batch : batches) {
+        contexts.emplace_back(batch->GetCurrentAccessContext());
+    }
+
+    std::array<size_t, static_cast<size_t>(AccessAddressType::kTypeCount)> entry_counts{};
+    for (const AccessContext *context : contexts) {
+        for (const auto address_type : kAddressTypes) {
+            entry_counts[static_cast<size_t>(address_type)] += context->GetAccessStateMap(address_type).size();
+        }
+    }
+
+    // Attribute map entries back to the resources bound at their (fake) addresses
+    std::vector<ResourceStats> resources;
+    ForEachShared<BUFFER_STATE>([&resources](const std::shared_ptr<BUFFER_STATE> &buffer) {
+        if (!SimpleBinding(*buffer)) return;
+        const VkDeviceSize base_address = ResourceBaseAddress(*buffer);
+        resources.emplace_back(ResourceStats{buffer->Handle(), AccessAddressType::kLinear,
+                                             ResourceAccessRange(base_address, base_address + buffer->createInfo.size), 0});
+    });
+    ForEachShared<IMAGE_STATE>([&resources](const std::shared_ptr<IMAGE_STATE> &image) {
+        if (!SimpleBinding(*image) || !image->fragment_encoder) return;
+        const VkDeviceSize base_address = ResourceBaseAddress(*image);
+        resources.emplace_back(ResourceStats{image->Handle(), AccessContext::ImageAddressType(*image),
+                                             ResourceAccessRange(base_address, base_address + image->fragment_encoder->TotalSize()),
+                                             0});
+    });
+    for (auto &resource : resources) {
+        for (const AccessContext *context : contexts) {
+            const auto &accesses = context->GetAccessStateMap(resource.address_type);
+            for (auto pos = accesses.lower_bound(resource.range); (pos != accesses.cend()) && resource.range.intersects(pos->first);
+                 ++pos) {
+                ++resource.entry_count;
+            }
+        }
+    }
+    const size_t largest_count = std::min(resources.size(), static_cast<size_t>(kStatsLargestResources));
+    std::partial_sort(resources.begin(), resources.begin() + largest_count, resources.end(),
+                      [](const ResourceStats &lhs, const ResourceStats &rhs) { return lhs.entry_count > rhs.entry_count; });
+
+    const uint64_t batches_destroyed = stats_.batches_destroyed.load();
+    std::stringstream out;
+    out << "Synchronization validation statistics:\n";
+    out << "  Access map entries: linear " << entry_counts[static_cast<size_t>(AccessAddressType::kLinear)] << ", idealized "
+        << entry_counts[static_cast<size_t>(AccessAddressType::kIdealized)] << " (";
+    if (include_command_buffers) {
+        out << cb_context_count << " command buffer access contexts, ";
+    }
+    out << batches.size() << " queue batch contexts)\n";
+    out << "  Commands recorded: " << stats_.commands.load() << ", hazard checks: " << stats_.hazard_checks.load()
+        << ", barrier applications: " << stats_.barrier_applications.load() << ", queue submits: " << stats_.queue_submits.load()
+        << "\n";
+    out << "  Access log: " << global_access_log_.RecordCount() << " submitted records, " << global_access_log_.MemoryUsage()
+        << " bytes";
+    if (include_command_buffers) {
+        out << ", command buffer logs " << cb_log_bytes << " bytes";
+    }
+    out << "\n";
+    out << "  Queue batch contexts: " << stats_.batches_created.load() << " created, " << batches_destroyed << " destroyed";
+    if (batches_destroyed) out << ", mean lifetime " << (stats_.batch_lifetime_us.load() / batches_destroyed) << "us";
+    out << "\n";
+    out << "  Largest resources by access map entries:";
+    for (size_t i = 0; i < largest_count && resources[i].entry_count; ++i) {
+        out << "\n    " << report_data->FormatHandle(resources[i].handle) << ": " << resources[i].entry_count;
+    }
+    LogInfo(device, "SYNC-stats", "%s", out.str().c_str());
+}
+
+// Only the tags still referenced by retained batch contexts can be reported in a hazard, the rest of the log is dead weight
+// Caller must hold queue_sync_lock_ for write
+void SyncValidator::TrimAccessLog() {
+    ResourceUsageTagSet used_tags;
+    const QueueBatchContext::BatchSet queue_batch_contexts = GetQueueBatchSnapshot();
+    for (const auto &batch : queue_batch_contexts) {
+        batch->GatherReferencedTags(used_tags);
+    }
+    global_access_log_.Trim(used_tags);
+
+    // If everything retained is still referenced, back off to avoid rescanning on every submit
+    if (access_log_limit_) {
+        access_log_trim_threshold_ = std::max(access_log_limit_, 2 * global_access_log_.RecordCount());
+    }
 }
 
 struct QueueSubmitCmdState {
@@ -7210,6 +7652,8 @@ bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCou
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (!enabled[sync_validation_queue_submit]) return skip;
 
+    // Submits to different queues validate concurrently against a snapshot of the shared state
+    ReadLockGuard lock(queue_sync_lock_);
     layer_data::TlsGuard<QueueSubmitCmdState> cmd_state(&skip, global_access_log_, signaled_semaphores_);
     const auto fence_state = Get<FENCE_STATE>(fence);
     cmd_state->queue = GetQueueSyncStateShared(queue);
@@ -7244,12 +7688,16 @@ bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCou
         }
 
         // Empty batches could have semaphores, though.
-        for (auto &sem : layer_data::make_span(submit.pSignalSemaphores, submit.signalSemaphoreCount)) {
+        const auto *timeline_info = LvlFindInChain<VkTimelineSemaphoreSubmitInfo>(submit.pNext);
+        for (uint32_t sem_idx = 0; sem_idx < submit.signalSemaphoreCount; ++sem_idx) {
             // Make a copy of the state, signal the copy and pend it...
-            auto sem_state = Get<SEMAPHORE_STATE>(sem);
+            auto sem_state = Get<SEMAPHORE_STATE>(submit.pSignalSemaphores[sem_idx]);
             if (!sem_state) continue;
             auto semaphore_info = lvl_init_struct<VkSemaphoreSubmitInfo>();
             semaphore_info.stageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT;
+            if (timeline_info && (sem_idx < timeline_info->signalSemaphoreValueCount)) {
+                semaphore_info.value = timeline_info->pSignalSemaphoreValues[sem_idx];
+            }
             cmd_state->signaled.SignalSemaphore(sem_state, batch, semaphore_info);
         }
         // Unless the previous batch was referenced by a signal, the QueueBatchContext will self destruct, but as
@@ -7279,28 +7727,42 @@ void SyncValidator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCoun
     if (VK_SUCCESS != result) return;  // dispatched QueueSubmit failed
     if (!cmd_state->queue) return;  // Validation couldn't find a valid queue object
 
+    WriteLockGuard lock(queue_sync_lock_);
+
     // Don't need to look up the queue state again, but we need a non-const version
     std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
 
     // The global  the semaphores we applied to the cmd_state QueueBatchContexts
     // NOTE: All conserved QueueBatchContext's need to have there access logs reset to use the global logger and the only conserved
     //       QBC's are those referenced by unwaited signals and the last batch.
-    for (auto &sig_sem : cmd_state->signaled) {
-        if (sig_sem.second && sig_sem.second->batch) {
-            auto &sig_batch = sig_sem.second->batch;
+    auto conserve_signal_batch = [&cmd_state](const std::shared_ptr<SignaledSemaphores::Signal> &signal) {
+        if (signal && signal->batch) {
+            auto &sig_batch = signal->batch;
             sig_batch->ResetAccessLog();
+            sig_batch->TrimSubmitState();
             // Batches retained for signalled semaphore don't need to retain event data, unless it's the last batch in the submit
             if (sig_batch != cmd_state->last_batch) {
                 sig_batch->ResetEventsContext();
             }
         }
+    };
+    for (auto &sig_sem : cmd_state->signaled) {
+        conserve_signal_batch(sig_sem.second);
         signaled_semaphores_.Import(sig_sem.first, std::move(sig_sem.second));
     }
+    // Timeline signals copied from the global state belong to batches conserved by earlier submits, only touch the new ones
+    for (const auto &signal : cmd_state->signaled.NewTimelineSignals()) {
+        conserve_signal_batch(signal);
+    }
+    for (auto &timeline : cmd_state->signaled.Timelines()) {
+        signaled_semaphores_.ImportTimeline(timeline.first, std::move(timeline.second));
+    }
     cmd_state->signaled.Reset();
 
     // Update the queue to point to the last batch from the submit
     if (cmd_state->last_batch) {
         cmd_state->last_batch->ResetAccessLog();
+        cmd_state->last_batch->TrimSubmitState();
 
         // Clean up the events data in the previous last batch on queue, as only the subsequent batches have valid use for them
         // and the QueueBatchContext::Setup calls have be copying them along from batch to batch during submit.
@@ -7313,9 +7775,20 @@ void SyncValidator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCoun
 
     // Update the global access log from the one built during validation
     global_access_log_.MergeMove(std::move(cmd_state->logger));
-
+    if (access_log_limit_ && (global_access_log_.RecordCount() > access_log_trim_threshold_)) {
+        TrimAccessLog();
+    }
 
     // WIP: record information about fences
+
+    if (report_stats_) {
+        // ReportStats takes the queue lock itself. Like at vkDeviceWaitIdle, other threads may still be recording.
+        lock.unlock();
+        const uint64_t submits = stats_.queue_submits.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (stats_report_interval_ && ((submits % stats_report_interval_) == 0)) {
+            ReportStats(false);
+        }
+    }
 }
 
 bool SyncValidator::PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -7338,7 +7811,7 @@ void SyncValidator::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submit
 }
 
 AttachmentViewGen::AttachmentViewGen(const IMAGE_VIEW_STATE *view, const VkOffset3D &offset, const VkExtent3D &extent)
-    : view_(view), view_mask_(), gen_store_() {
+    : view_(view), view_mask_(), offset_(offset), extent_(extent), gen_store_(), ranges_store_() {
     if (!view_ || !view_->image_state || !SimpleBinding(*view_->image_state)) return;
     const IMAGE_STATE &image_state = *view_->image_state.get();
     const auto base_address = ResourceBaseAddress(image_state);
@@ -7365,29 +7838,46 @@ AttachmentViewGen::AttachmentViewGen(const IMAGE_VIEW_STATE *view, const VkOffse
         gen_store_[Gen::kStencilOnlyRenderArea].emplace(*encoder, subres_range, offset, extent, base_address,
                                                         view->IsDepthSliced());
     }
+    ranges_store_ = std::make_shared<RangesStore>();
 }
 
-const ImageRangeGen *AttachmentViewGen::GetRangeGen(AttachmentViewGen::Gen gen_type) const {
-    const ImageRangeGen *got = nullptr;
+AttachmentViewGen::Gen AttachmentViewGen::StoreIndex(AttachmentViewGen::Gen gen_type) const {
     switch (gen_type) {
         case kViewSubresource:
-            got = &gen_store_[kViewSubresource];
-            break;
         case kRenderArea:
-            got = &gen_store_[kRenderArea];
-            break;
+            return gen_type;
         case kDepthOnlyRenderArea:
-            got =
-                (view_mask_ == VK_IMAGE_ASPECT_DEPTH_BIT) ? &gen_store_[Gen::kRenderArea] : &gen_store_[Gen::kDepthOnlyRenderArea];
-            break;
+            return (view_mask_ == VK_IMAGE_ASPECT_DEPTH_BIT) ? kRenderArea : kDepthOnlyRenderArea;
         case kStencilOnlyRenderArea:
-            got = (view_mask_ == VK_IMAGE_ASPECT_STENCIL_BIT) ? &gen_store_[Gen::kRenderArea]
-                                                              : &gen_store_[Gen::kStencilOnlyRenderArea];
-            break;
+            return (view_mask_ == VK_IMAGE_ASPECT_STENCIL_BIT) ? kRenderArea : kStencilOnlyRenderArea;
         default:
-            assert(got);
+            assert(gen_type < kGenSize);
     }
-    return got;
+    return gen_type;
+}
+
+const ImageRangeGen *AttachmentViewGen::GetRangeGen(AttachmentViewGen::Gen gen_type) const {
+    return &gen_store_[StoreIndex(gen_type)];
+}
+
+const AttachmentViewGen::AttachmentRanges *AttachmentViewGen::GetRanges(AttachmentViewGen::Gen gen_type) const {
+    const Gen store_index = StoreIndex(gen_type);
+    const RangeGenStore &gen = gen_store_[store_index];
+    if (!gen) return nullptr;
+    assert(ranges_store_);
+    RangesStore &store = *ranges_store_;
+    std::call_once(store.built[store_index], [this, &store, store_index]() {
+        // Use the same aspects, offset and extent as the gen_store_ generator for this index
+        VkImageAspectFlags aspect_mask = view_mask_;
+        if (store_index == kDepthOnlyRenderArea) aspect_mask &= VK_IMAGE_ASPECT_DEPTH_BIT;
+        if (store_index == kStencilOnlyRenderArea) aspect_mask &= VK_IMAGE_ASPECT_STENCIL_BIT;
+        const bool whole_view = (store_index == kViewSubresource);
+        const VkOffset3D offset = whole_view ? view_->GetOffset() : offset_;
+        const VkExtent3D extent = whole_view ? view_->GetExtent() : extent_;
+        store.ranges[store_index] =
+            view_->GetAttachmentRanges(aspect_mask, offset, extent, ResourceBaseAddress(*view_->image_state));
+    });
+    return store.ranges[store_index].get();
 }
 
 AttachmentViewGen::Gen AttachmentViewGen::GetDepthStencilRenderAreaGenType(bool depth_op, bool stencil_op) const {
@@ -7427,15 +7917,36 @@ void SyncEventsContext::ApplyBarrier(const SyncExecScope &src, const SyncExecSco
 }
 
 void SyncEventsContext::ApplyTaggedWait(VkQueueFlags queue_flags, ResourceUsageTag tag) {
+    // Queue batch contexts can live long after their events are destroyed, so drop them at each host wait as well
+    RemoveDestroyed();
     const SyncExecScope src_scope =
         SyncExecScope::MakeSrc(queue_flags, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_2_HOST_BIT);
     const SyncExecScope dst_scope = SyncExecScope::MakeDst(queue_flags, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
     ApplyBarrier(src_scope, dst_scope, tag);
 }
 
+void SyncEventsContext::GatherReferencedTags(ResourceUsageTagSet &used) const {
+    for (const auto &event : map_) {
+        if (event.second && event.second->first_scope) {
+            event.second->first_scope->GatherReferencedTags(used);
+        }
+    }
+}
+
+void SyncEventsContext::RemoveDestroyed() {
+    for (auto event_it = map_.begin(); event_it != map_.end();) {
+        if (event_it->second->event->Destroyed()) {
+            event_it = map_.erase(event_it);
+        } else {
+            ++event_it;
+        }
+    }
+}
+
 SyncEventsContext &SyncEventsContext::DeepCopy(const SyncEventsContext &from) {
     // We need a deep copy of the const context to update during validation phase
     for (const auto &event : from.map_) {
+        if (event.second->event->Destroyed()) continue;
         map_.emplace(event.first, std::make_shared<SyncEventState>(*event.second));
     }
     return *this;
@@ -7484,7 +7995,24 @@ void ReplayTrackbackBarriersAction::TrackbackBarriers::operator()(ResourceAccess
 }
 
 QueueBatchContext::QueueBatchContext(const SyncValidator &sync_state, const QueueSyncState &queue_state)
-    : CommandExecutionContext(&sync_state), queue_state_(&queue_state), tag_range_(0, 0), batch_log_(nullptr) {}
+    : CommandExecutionContext(&sync_state), queue_state_(&queue_state), tag_range_(0, 0), batch_log_(nullptr) {
+    SyncStats *stats = sync_state.GetStats();
+    access_context_.SetStats(stats);
+    if (stats->Enabled()) {
+        stats->Add(stats->batches_created);
+        created_ = std::chrono::steady_clock::now();
+    }
+}
+
+QueueBatchContext::~QueueBatchContext() {
+    if (created_ != std::chrono::steady_clock::time_point()) {
+        SyncStats *stats = access_context_.GetStats();
+        const auto lifetime = std::chrono::steady_clock::now() - created_;
+        stats->Add(stats->batches_destroyed);
+        stats->Add(stats->batch_lifetime_us,
+                   static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(lifetime).count()));
+    }
+}
 
 template <typename BatchInfo>
 void QueueBatchContext::Setup(const std::shared_ptr<const QueueBatchContext> &prev_batch, const BatchInfo &batch_info,
@@ -7508,6 +8036,8 @@ void QueueBatchContext::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag)
         for (const auto &address : wait_worm.erase_list) {
             access_context_.DeleteAccess(address);
         }
+        // The wait often leaves neighboring ranges with identical (e.g. write-only) state, fold them together
+        access_context_.Consolidate();
     }
 
     if (queue_id == GetQueueId()) {
@@ -7515,12 +8045,26 @@ void QueueBatchContext::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag)
     }
 }
 
+void QueueBatchContext::TrimSubmitState() {
+    // The async contexts are only used for hazard detection while the batch is validated. Holding the async batches past
+    // that point chains every conserved batch to the ones on the other queues before it, such that the retained batch
+    // graph grows without bound in multi-queue steady state.
+    access_context_.ClearAsyncContexts();
+    async_batches_.clear();
+    command_buffers_.clear();
+}
+
 // Clear all accesses
 void QueueBatchContext::ApplyDeviceWait() {
     access_context_.Reset();
     events_context_.ApplyTaggedWait(GetQueueFlags(), ResourceUsageRecord::kMaxIndex);
 }
 
+void QueueBatchContext::GatherReferencedTags(ResourceUsageTagSet &used) const {
+    access_context_.GatherReferencedTags(used);
+    events_context_.GatherReferencedTags(used);
+}
+
 class ApplySemaphoreBarrierAction {
   public:
     ApplySemaphoreBarrierAction(const SemaphoreScope &signal, const SemaphoreScope &wait) : signal_(signal), wait_(wait) {}
@@ -7532,12 +8076,15 @@ class ApplySemaphoreBarrierAction {
 };
 
 std::shared_ptr<QueueBatchContext> QueueBatchContext::ResolveOneWaitSemaphore(VkSemaphore sem, VkPipelineStageFlags2 wait_mask,
-                                                                              SignaledSemaphores &signaled) {
+                                                                              uint64_t value, SignaledSemaphores &signaled) {
     auto sem_state = sync_state_->Get<SEMAPHORE_STATE>(sem);
     if (!sem_state) return nullptr;  // Semaphore validity is handled by CoreChecks
 
     // When signal state goes out of scope, the signal information will be dropped, as Unsignal has released ownership.
-    auto signal_state = signaled.Unsignal(sem);
+    // Timeline signals remain in place for subsequent waits until every queue has waited past them.
+    auto signal_state = (sem_state->type == VK_SEMAPHORE_TYPE_TIMELINE)
+                            ? signaled.WaitTimeline(sem, GetQueueId(), value, sync_state_->queue_sync_states_.size())
+                            : signaled.Unsignal(sem);
     if (!signal_state) return nullptr;  // Invalid signal, skip it.
 
     assert(signal_state->batch);
@@ -7556,6 +8103,7 @@ std::shared_ptr<QueueBatchContext> QueueBatchContext::ResolveOneWaitSemaphore(Vk
         ApplySemaphoreBarrierAction sem_op(signal_scope, wait_scope);
         access_context_.ResolveFromContext(sem_op, signal_state->batch->access_context_);
     }
+    access_context_.CountBarrierApplications(1);
     // Cannot move from the signal state because it could be from the const global state, and C++ doesn't
     // enforce deep constness.
     return signal_state->batch;
@@ -7565,15 +8113,22 @@ std::shared_ptr<QueueBatchContext> QueueBatchContext::ResolveOneWaitSemaphore(Vk
 template <>
 class QueueBatchContext::SubmitInfoAccessor<VkSubmitInfo> {
   public:
-    SubmitInfoAccessor(const VkSubmitInfo &info) : info_(info) {}
+    SubmitInfoAccessor(const VkSubmitInfo &info)
+        : info_(info), timeline_info_(LvlFindInChain<VkTimelineSemaphoreSubmitInfo>(info.pNext)) {}
     inline uint32_t WaitSemaphoreCount() const { return info_.waitSemaphoreCount; }
     inline VkSemaphore WaitSemaphore(uint32_t index) { return info_.pWaitSemaphores[index]; }
     inline VkPipelineStageFlags2 WaitDstMask(uint32_t index) { return info_.pWaitDstStageMask[index]; }
+    // Ignored for binary semaphores
+    inline uint64_t WaitValue(uint32_t index) const {
+        return (timeline_info_ && (index < timeline_info_->waitSemaphoreValueCount)) ? timeline_info_->pWaitSemaphoreValues[index]
+                                                                                      : 0U;
+    }
     inline uint32_t CommandBufferCount() const { return info_.commandBufferCount; }
     inline VkCommandBuffer CommandBuffer(uint32_t index) { return info_.pCommandBuffers[index]; }
 
   private:
     const VkSubmitInfo &info_;
+    const VkTimelineSemaphoreSubmitInfo *timeline_info_;
 };
 template <typename BatchInfo, typename Fn>
 void QueueBatchContext::ForEachWaitSemaphore(const BatchInfo &batch_info, Fn &&func) {
@@ -7581,7 +8136,7 @@ void QueueBatchContext::ForEachWaitSemaphore(const BatchInfo &batch_info, Fn &&f
     Accessor batch(batch_info);
     const uint32_t wait_count = batch.WaitSemaphoreCount();
     for (uint32_t i = 0; i < wait_count; ++i) {
-        func(batch.WaitSemaphore(i), batch.WaitDstMask(i));
+        func(batch.WaitSemaphore(i), batch.WaitDstMask(i), batch.WaitValue(i));
     }
 }
 
@@ -7595,12 +8150,13 @@ void QueueBatchContext::SetupAccessContext(const std::shared_ptr<const QueueBatc
 
     // Import (resolve) the batches that are waited on, with the semaphore's effective barriers applied
     layer_data::unordered_set<std::shared_ptr<const QueueBatchContext>> batches_resolved;
-    ForEachWaitSemaphore(batch_info, [this, &signaled, &batches_resolved](VkSemaphore sem, VkPipelineStageFlags2 wait_mask) {
-        std::shared_ptr<QueueBatchContext> resolved = ResolveOneWaitSemaphore(sem, wait_mask, signaled);
-        if (resolved) {
-            batches_resolved.emplace(std::move(resolved));
-        }
-    });
+    ForEachWaitSemaphore(batch_info,
+                         [this, &signaled, &batches_resolved](VkSemaphore sem, VkPipelineStageFlags2 wait_mask, uint64_t value) {
+                             std::shared_ptr<QueueBatchContext> resolved = ResolveOneWaitSemaphore(sem, wait_mask, value, signaled);
+                             if (resolved) {
+                                 batches_resolved.emplace(std::move(resolved));
+                             }
+                         });
 
     // If there are no semaphores to the previous batch, make sure a "submit order" non-barriered import is done
     if (prev && !layer_data::Contains(batches_resolved, prev)) {
@@ -7715,6 +8271,43 @@ void AccessLogger::Reset() {
     access_log_map_.clear();
 }
 
+void AccessLogger::Trim(const ResourceUsageTagSet &used) {
+    std::vector<size_t> retained;
+    auto log_it = access_log_map_.begin();
+    while (log_it != access_log_map_.end()) {
+        const ResourceUsageRange &range = log_it->first;
+        const auto used_begin = used.lower_bound(range.begin);
+        const auto used_end = used.lower_bound(range.end);
+        if (used_begin == used_end) {
+            // Nothing can report a hazard against this batch anymore
+            log_it = access_log_map_.erase(log_it);
+            continue;
+        }
+        retained.clear();
+        for (auto used_it = used_begin; used_it != used_end; ++used_it) {
+            retained.emplace_back(*used_it - range.begin);
+        }
+        log_it->second.Compact(retained);
+        ++log_it;
+    }
+}
+
+size_t AccessLogger::RecordCount() const {
+    size_t count = 0;
+    for (const auto &batch_log : access_log_map_) {
+        count += batch_log.second.RecordCount();
+    }
+    return count;
+}
+
+size_t AccessLogger::MemoryUsage() const {
+    size_t bytes = 0;
+    for (const auto &batch_log : access_log_map_) {
+        bytes += batch_log.second.MemoryUsage();
+    }
+    return bytes;
+}
+
 // Since we're updating the QueueSync state, this is Record phase and the access log needs to point to the global one
 // Batch Contexts saved during signalling have their AccessLog reset when the pending signals are signalled.
 // NOTE: By design, QueueBatchContexts that are neither last, nor referenced by a signal are abandoned as unowned, since
@@ -7731,16 +8324,51 @@ void QueueSyncState::SetLastBatch(std::shared_ptr<QueueBatchContext> &&last) {
 uint64_t QueueSyncState::ReserveSubmitId() const { return submit_index_.fetch_add(1); }
 
 void AccessLogger::BatchLog::Append(const CommandExecutionContext::AccessLog &other) {
+    assert(retained_index_.empty());  // Compacted logs are read only
     log_.insert(log_.end(), other.cbegin(), other.cend());
+    size_ = log_.size();
     for (const auto &record : other) {
         assert(record.cb_state);
         cbs_referenced_.insert(record.cb_state->shared_from_this());
     }
 }
 
+void AccessLogger::BatchLog::Compact(const std::vector<size_t> &retained) {
+    if (retained.size() == log_.size()) return;  // Nothing to drop
+
+    CommandExecutionContext::AccessLog compact_log;
+    std::vector<size_t> compact_index;
+    layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>> compact_cbs;
+    compact_log.reserve(retained.size());
+    compact_index.reserve(retained.size());
+    for (const size_t index : retained) {
+        const ResourceUsageRecord *record = (*this)[index].record;
+        if (!record) continue;
+        compact_log.emplace_back(*record);
+        compact_index.emplace_back(index);
+        compact_cbs.insert(record->cb_state->shared_from_this());
+    }
+    // Releasing the unreferenced command buffer shared_ptrs is the bulk of the savings
+    log_ = std::move(compact_log);
+    retained_index_ = std::move(compact_index);
+    cbs_referenced_ = std::move(compact_cbs);
+}
+
+size_t AccessLogger::BatchLog::MemoryUsage() const {
+    return sizeof(BatchLog) + log_.capacity() * sizeof(ResourceUsageRecord) + retained_index_.capacity() * sizeof(size_t) +
+           cbs_referenced_.size() * sizeof(std::shared_ptr<const CMD_BUFFER_STATE>);
+}
+
 AccessLogger::AccessRecord AccessLogger::BatchLog::operator[](size_t index) const {
-    assert(index < log_.size());
-    return AccessRecord{&batch_, &log_[index]};
+    assert(index < size_);
+    if (retained_index_.empty()) {
+        return AccessRecord{&batch_, (index < log_.size()) ? &log_[index] : nullptr};
+    }
+    const auto found = std::lower_bound(retained_index_.cbegin(), retained_index_.cend(), index);
+    if ((found == retained_index_.cend()) || (*found != index)) {
+        return AccessRecord{&batch_, nullptr};
+    }
+    return AccessRecord{&batch_, &log_[static_cast<size_t>(found - retained_index_.cbegin())]};
 }
 
 AccessLogger::AccessRecord AccessLogger::operator[](ResourceUsageTag tag) const {
@@ -7768,8 +8396,9 @@ std::shared_ptr<const SignaledSemaphores::Signal> SignaledSemaphores::GetPrev(Vk
 }
 
 SignaledSemaphores::Signal::Signal(const std::shared_ptr<const SEMAPHORE_STATE> &sem_state_,
-                                   const std::shared_ptr<QueueBatchContext> &batch_, const SyncExecScope &exec_scope_)
-    : sem_state(sem_state_), batch(batch_), first_scope({batch->GetQueueId(), exec_scope_}) {
+                                   const std::shared_ptr<QueueBatchContext> &batch_, const SyncExecScope &exec_scope_,
+                                   uint64_t payload_)
+    : sem_state(sem_state_), batch(batch_), first_scope({batch->GetQueueId(), exec_scope_}), payload(payload_) {
     // Illegal to create a signal from no batch or an invalid semaphore... caller must assure validity
     assert(batch);
     assert(sem_state);
@@ -21,8 +21,11 @@
 
 #pragma once
 
+#include <chrono>
 #include <limits>
+#include <map>
 #include <memory>
+#include <set>
 #include <vulkan/vulkan.h>
 
 #include "synchronization_validation_types.h"
@@ -38,6 +41,7 @@ class ResourceAccessState;
 struct ResourceFirstAccess;
 class SyncEventsContext;
 struct SyncEventState;
+class SyncStats;
 class SyncValidator;
 
 using ImageRangeEncoder = subresource_adapter::ImageRangeEncoder;
@@ -124,14 +128,34 @@ struct ResourceUsageRecord {
 // The resource tag index is relative to the command buffer or queue in which it's found
 using ResourceUsageTag = ResourceUsageRecord::TagIndex;
 using ResourceUsageRange = sparse_container::range<ResourceUsageTag>;
+// Ordered, as log trimming walks the referenced tags in step with the (ordered) access log ranges
+using ResourceUsageTagSet = std::set<ResourceUsageTag>;
 
+struct ResourceFirstAccess {
+    ResourceUsageTag tag;
+    SyncStageAccessIndex usage_index;
+    SyncOrdering ordering_rule;
+    ResourceFirstAccess(ResourceUsageTag tag_, SyncStageAccessIndex usage_index_, SyncOrdering ordering_rule_)
+        : tag(tag_), usage_index(usage_index_), ordering_rule(ordering_rule_){};
+    ResourceFirstAccess(const ResourceFirstAccess &other) = default;
+    ResourceFirstAccess(ResourceFirstAccess &&other) = default;
+    ResourceFirstAccess &operator=(const ResourceFirstAccess &rhs) = default;
+    ResourceFirstAccess &operator=(ResourceFirstAccess &&rhs) = default;
+    bool operator==(const ResourceFirstAccess &rhs) const {
+        return (tag == rhs.tag) && (usage_index == rhs.usage_index) && (ordering_rule == rhs.ordering_rule);
+    }
+};
+
+// HazardResult is returned by value through the detector layers, so it holds only what is needed to report the hazard, inline.
 struct HazardResult {
-    std::unique_ptr<const ResourceAccessState> access_state;
-    std::unique_ptr<const ResourceFirstAccess> recorded_access;
+    layer_data::optional<ResourceFirstAccess> recorded_access;
     SyncStageAccessIndex usage_index = std::numeric_limits<SyncStageAccessIndex>::max();
     SyncHazard hazard = NONE;
     SyncStageAccessFlags prior_access = 0U;  // TODO -- change to a NONE enum in ...Bits
     ResourceUsageTag tag = ResourceUsageTag();
+    // Barrier state of the prior access, the read barriers for hazards vs. reads, the write barriers otherwise
+    VkPipelineStageFlags2KHR read_barriers = 0U;
+    SyncStageAccessFlags write_barriers = 0U;
     void Set(const ResourceAccessState *access_state_, SyncStageAccessIndex usage_index_, SyncHazard hazard_,
              const SyncStageAccessFlags &prior_, ResourceUsageTag tag_);
     void AddRecordedAccess(const ResourceFirstAccess &first_access);
@@ -204,13 +228,14 @@ class SignaledSemaphores {
         Signal &operator=(const Signal &other) = default;
         Signal &operator=(Signal &&other) = default;
         Signal(const std::shared_ptr<const SEMAPHORE_STATE> &sem_state_, const std::shared_ptr<QueueBatchContext> &batch_,
-               const SyncExecScope &exec_scope_);
+               const SyncExecScope &exec_scope_, uint64_t payload_);
 
         std::shared_ptr<const SEMAPHORE_STATE> sem_state;
         std::shared_ptr<QueueBatchContext> batch;
         // Use the SyncExecScope::valid_accesses for first access scope
         SemaphoreScope first_scope;
-        // TODO add timeline semaphore support.
+        // The signaled value for timeline semaphores, zero for binary semaphores
+        uint64_t payload = 0;
     };
     using SignalMap = layer_data::unordered_map<VkSemaphore, std::shared_ptr<Signal>>;
     using iterator = SignalMap::iterator;
@@ -221,35 +246,51 @@ class SignaledSemaphores {
     iterator end() { return signaled_.end(); }
     const_iterator end() const { return signaled_.end(); }
 
+    // Timeline semaphores keep a signal per payload, as each wait is satisfied by the first signal reaching its value
+    struct Timeline {
+        std::map<uint64_t, std::shared_ptr<Signal>> signals;
+        // The largest value waited for by each queue waiting on the semaphore. Once every queue of the device has waited, a
+        // signal below all of these can't be the first signal reaching any later wait, and is dropped.
+        layer_data::unordered_map<QueueId, uint64_t> waited;
+    };
+    using TimelineMap = layer_data::unordered_map<VkSemaphore, Timeline>;
+
     bool SignalSemaphore(const std::shared_ptr<const SEMAPHORE_STATE> &sem_state, const std::shared_ptr<QueueBatchContext> &batch,
                          const VkSemaphoreSubmitInfo &signal_info);
     std::shared_ptr<const Signal> Unsignal(VkSemaphore);
+    // Timeline semaphore waits don't consume the signal, as any number of waits may be satisfied by it
+    std::shared_ptr<const Signal> WaitTimeline(VkSemaphore sem, QueueId queue, uint64_t value, size_t queue_count);
     void Import(VkSemaphore sem, std::shared_ptr<Signal> &&move_from);
+    void ImportTimeline(VkSemaphore sem, Timeline &&move_from);
+    // Drop all pending signals of the semaphore (binary or timeline)
+    void Erase(VkSemaphore sem);
+    // Keep only the last signal of each timeline, once the device is idle
+    void DropCompletedTimelineSignals();
     void Reset();
     SignaledSemaphores() : prev_(nullptr) {}
     SignaledSemaphores(const SignaledSemaphores &prev) : prev_(&prev) {}
 
+    TimelineMap &Timelines() { return timelines_; }
+    // The timeline signals added to this overlay, whose batches are conserved when it is imported
+    const std::vector<std::shared_ptr<Signal>> &NewTimelineSignals() const { return new_timeline_signals_; }
+    template <typename Fn>
+    void ForEachTimelineSignal(Fn &&fn) const {
+        for (const auto &timeline : timelines_) {
+            for (const auto &signal : timeline.second.signals) {
+                fn(signal.second);
+            }
+        }
+    }
+
   private:
     std::shared_ptr<const Signal> GetPrev(VkSemaphore sem) const;
+    Timeline &GetTimeline(VkSemaphore sem);
     layer_data::unordered_map<VkSemaphore, std::shared_ptr<Signal>> signaled_;
+    TimelineMap timelines_;
+    std::vector<std::shared_ptr<Signal>> new_timeline_signals_;
     const SignaledSemaphores *prev_;  // Allowing this type to act as a writable overlay
 };
 
-struct ResourceFirstAccess {
-    ResourceUsageTag tag;
-    SyncStageAccessIndex usage_index;
-    SyncOrdering ordering_rule;
-    ResourceFirstAccess(ResourceUsageTag tag_, SyncStageAccessIndex usage_index_, SyncOrdering ordering_rule_)
-        : tag(tag_), usage_index(usage_index_), ordering_rule(ordering_rule_){};
-    ResourceFirstAccess(const ResourceFirstAccess &other) = default;
-    ResourceFirstAccess(ResourceFirstAccess &&other) = default;
-    ResourceFirstAccess &operator=(const ResourceFirstAccess &rhs) = default;
-    ResourceFirstAccess &operator=(ResourceFirstAccess &&rhs) = default;
-    bool operator==(const ResourceFirstAccess &rhs) const {
-        return (tag == rhs.tag) && (usage_index == rhs.usage_index) && (ordering_rule == rhs.ordering_rule);
-    }
-};
-
 using QueueId = uint32_t;
 class ResourceAccessState : public SyncStageAccess {
   protected:
@@ -265,6 +306,9 @@ class ResourceAccessState : public SyncStageAccess {
             access_scope |= rhs.access_scope;
             return *this;
         }
+        bool operator==(const OrderingBarrier &rhs) const {
+            return (exec_scope == rhs.exec_scope) && (access_scope == rhs.access_scope);
+        }
     };
     using OrderingBarriers = std::array<OrderingBarrier, static_cast<size_t>(SyncOrdering::kNumOrderings)>;
     using FirstAccesses = small_vector<ResourceFirstAccess, 3>;
@@ -274,20 +318,23 @@ class ResourceAccessState : public SyncStageAccess {
     // but only up to one per pipeline stage (as another read from the *same* stage become more recent,
     // and applicable one for hazard detection
     struct ReadState {
-        VkPipelineStageFlags2KHR stage;  // The stage of this read
-        SyncStageAccessFlags access;    // TODO: Change to FlagBits when we have a None bit enum
-                                        // TODO: Revisit whether this needs to support multiple reads per stage
-        VkPipelineStageFlags2KHR barriers;  // all applicable barriered stages
+        // Field order keeps the 64-bit members together so the state packs into 48 bytes.  The access is stored as an index
+        // rather than a full SyncStageAccessFlags mask, as each read state records exactly one access.
+        VkPipelineStageFlags2KHR stage;        // The stage of this read
+        VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
+        VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
         ResourceUsageTag tag;
+        SyncStageAccessIndex access_index;  // The one access (within stage) this read records
         QueueId queue;
-        VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
-                                                     // Excluded from comparison
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTag tag_);
+        SyncStageAccessFlags Access() const { return SyncStageAccess::FlagBit(access_index); }
         bool operator==(const ReadState &rhs) const {
-            bool same = (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) && (tag == rhs.tag);
+            bool same = (stage == rhs.stage) && (access_index == rhs.access_index) && (barriers == rhs.barriers) &&
+                        (tag == rhs.tag) && (queue == rhs.queue) && (sync_stages == rhs.sync_stages) &&
+                        (pending_dep_chain == rhs.pending_dep_chain);
             return same;
         }
         bool IsReadBarrierHazard(VkPipelineStageFlags2KHR src_exec_scope) const {
@@ -305,7 +352,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_index_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTag tag_);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
@@ -367,6 +414,7 @@ class ResourceAccessState : public SyncStageAccess {
     template <typename Pred>
     bool ApplyQueueTagWait(Pred &&);
     bool FirstAccessInTagRange(const ResourceUsageRange &tag_range) const;
+    void GatherReferencedTags(ResourceUsageTagSet &used) const;
 
     void OffsetTag(ResourceUsageTag offset);
     ResourceAccessState();
@@ -375,11 +423,18 @@ class ResourceAccessState : public SyncStageAccess {
         return (0 != pending_layout_transition) || pending_write_barriers.any() || (0 != pending_write_dep_chain);
     }
     bool HasWriteOp() const { return last_write != 0; }
+    // Compares every member, as consolidation merges neighboring ranges whose states compare equal
     bool operator==(const ResourceAccessState &rhs) const {
         bool same = (write_barriers == rhs.write_barriers) && (write_dependency_chain == rhs.write_dependency_chain) &&
                     (last_reads == rhs.last_reads) && (last_read_stages == rhs.last_read_stages) && (write_tag == rhs.write_tag) &&
+                    (last_write == rhs.last_write) && (write_queue == rhs.write_queue) &&
                     (input_attachment_read == rhs.input_attachment_read) &&
-                    (read_execution_barriers == rhs.read_execution_barriers) && (first_accesses_ == rhs.first_accesses_);
+                    (read_execution_barriers == rhs.read_execution_barriers) && (first_accesses_ == rhs.first_accesses_) &&
+                    (pending_write_barriers == rhs.pending_write_barriers) &&
+                    (pending_write_dep_chain == rhs.pending_write_dep_chain) && (first_read_stages_ == rhs.first_read_stages_) &&
+                    (pending_layout_transition == rhs.pending_layout_transition) &&
+                    (pending_layout_ordering_ == rhs.pending_layout_ordering_) &&
+                    (first_write_layout_ordering_ == rhs.first_write_layout_ordering_);
         return same;
     }
     bool operator!=(const ResourceAccessState &rhs) const { return !(*this == rhs); }
@@ -480,29 +535,30 @@ class ResourceAccessState : public SyncStageAccess {
     // With reads, each must be "safe" relative to it's prior write, so we need only
     // save the most recent write operation (as anything *transitively* unsafe would arleady
     // be included
+    // Members are grouped by size (the bitsets, then 64-bit, then the 32-bit queue id and the flags) to avoid padding, as
+    // there is one ResourceAccessState per range map entry.
     SyncStageAccessFlags write_barriers;          // union of applicable barrier masks since last write
+    SyncStageAccessFlags last_write;              // only the most recent write
+    SyncStageAccessFlags pending_write_barriers;  // Pending execution state to support independent parallel barriers
     VkPipelineStageFlags2KHR write_dependency_chain;  // intiially zero, but accumulating the dstStages of barriers if they chain.
     ResourceUsageTag write_tag;
+    VkPipelineStageFlags2KHR last_read_stages;
+    VkPipelineStageFlags2KHR read_execution_barriers;
+    VkPipelineStageFlags2KHR pending_write_dep_chain;
+    VkPipelineStageFlags2KHR first_read_stages_;
     QueueId write_queue;
-    SyncStageAccessFlags last_write;  // only the most recent write
 
     // TODO Input Attachment cleanup for multiple reads in a given stage
     // Tracks whether the fragment shader read is input attachment read
     bool input_attachment_read;
+    bool pending_layout_transition;
 
-    VkPipelineStageFlags2KHR last_read_stages;
-    VkPipelineStageFlags2KHR read_execution_barriers;
     using ReadStates = small_vector<ReadState, 3, uint32_t>;
     ReadStates last_reads;
 
-    // Pending execution state to support independent parallel barriers
-    VkPipelineStageFlags2KHR pending_write_dep_chain;
-    bool pending_layout_transition;
-    SyncStageAccessFlags pending_write_barriers;
     OrderingBarrier pending_layout_ordering_;
-    FirstAccesses first_accesses_;
-    VkPipelineStageFlags2KHR first_read_stages_;
     OrderingBarrier first_write_layout_ordering_;
+    FirstAccesses first_accesses_;
 
     static OrderingBarriers kOrderingRules;
 };
@@ -524,14 +580,29 @@ class AttachmentViewGen {
     AccessAddressType GetAddressType() const;
     const IMAGE_VIEW_STATE *GetViewState() const { return view_; }
     const ImageRangeGen *GetRangeGen(Gen type) const;
+    // The encoded address ranges of each gen type, fetched on first use so that per-draw and per-op attachment accesses
+    // iterate a flat list instead of re-running the image range generator. The lists are memoized by the IMAGE_VIEW_STATE,
+    // so later render pass instances with the same render area reuse them. Gen types never used aren't flattened.
+    using AttachmentRanges = IMAGE_VIEW_STATE::AttachmentRanges;
+    const AttachmentRanges *GetRanges(Gen type) const;
     bool IsValid() const { return gen_store_[Gen::kViewSubresource]; }
     Gen GetDepthStencilRenderAreaGenType(bool depth_op, bool stencil_op) const;
 
   private:
     using RangeGenStore = layer_data::optional<ImageRangeGen>;
+    // Shared by copies of the view gen, which describe the same ranges. Validation of a submitted command buffer can build
+    // the lists concurrently with other submissions, so each one is built under its own once_flag.
+    struct RangesStore {
+        std::array<std::once_flag, Gen::kGenSize> built;
+        std::array<std::shared_ptr<const AttachmentRanges>, Gen::kGenSize> ranges;
+    };
+    Gen StoreIndex(Gen gen_type) const;
     const IMAGE_VIEW_STATE *view_ = nullptr;
     VkImageAspectFlags view_mask_ = 0U;
+    VkOffset3D offset_ = {};
+    VkExtent3D extent_ = {};
     std::array<RangeGenStore, Gen::kGenSize> gen_store_;
+    std::shared_ptr<RangesStore> ranges_store_;
 };
 
 using AttachmentViewGenVector = std::vector<AttachmentViewGen>;
@@ -872,6 +943,7 @@ class AccessContext {
                               const VkImageSubresourceRange &subresource_range, bool is_depth_sliced) const;
     HazardResult DetectHazard(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type,
                               SyncStageAccessIndex current_usage, SyncOrdering ordering_rule) const;
+    HazardResult DetectHazard(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage, bool is_depth_sliced) const;
 
     HazardResult DetectHazard(const IMAGE_STATE &image, SyncStageAccessIndex current_usage,
                               const VkImageSubresourceRange &subresource_range, SyncOrdering ordering_rule,
@@ -904,6 +976,7 @@ class AccessContext {
         for (auto &map : access_state_maps_) {
             map.clear();
         }
+        coalesced_reads_.Clear();
     }
 
     // Follow the context previous to access the access state, supporting "lazy" import into the context. Not intended for
@@ -930,6 +1003,14 @@ class AccessContext {
 
     void UpdateAccessState(const BUFFER_STATE &buffer, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const ResourceAccessRange &range, ResourceUsageTag tag);
+    // For read-only buffer accesses repeated across commands, such as vertex and index fetch for consecutive draws.
+    // A hazard free read identical to one already recorded, with no other access or barrier affecting the range since,
+    // would leave the access state unchanged apart from the tag, so it is neither detected nor recorded again. The state
+    // retains the tag of the first read of the run.
+    bool IsCoalescedRead(const BUFFER_STATE &buffer, SyncStageAccessIndex read_index, const ResourceAccessRange &range) const;
+    void UpdateCoalescedReadState(const BUFFER_STATE &buffer, SyncStageAccessIndex read_index, const ResourceAccessRange &range,
+                                  ResourceUsageTag tag);
+    void ClearCoalescedReads() { coalesced_reads_.Clear(); }
     void UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const VkImageSubresourceRange &subresource_range, const ResourceUsageTag &tag);
     void UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
@@ -937,6 +1018,8 @@ class AccessContext {
                            ResourceUsageTag tag);
     void UpdateAccessState(const AttachmentViewGen &view_gen, AttachmentViewGen::Gen gen_type, SyncStageAccessIndex current_usage,
                            SyncOrdering ordering_rule, ResourceUsageTag tag);
+    void UpdateAccessState(const IMAGE_VIEW_STATE &view, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
+                           bool is_depth_sliced, ResourceUsageTag tag);
     void UpdateAccessState(const IMAGE_STATE &image, SyncStageAccessIndex current_usage, SyncOrdering ordering_rule,
                            const VkImageSubresourceLayers &subresource, const VkOffset3D &offset, const VkExtent3D &extent,
                            ResourceUsageTag tag);
@@ -963,7 +1046,11 @@ class AccessContext {
     AccessContext() { Reset(); }
     AccessContext(const AccessContext &copy_from) = default;
 
-    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) { return access_state_maps_[static_cast<size_t>(type)]; }
+    // Any state in the returned map may change, so none of the coalesced reads for it can be assumed to be idempotent
+    ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) {
+        if (type == AccessAddressType::kLinear) coalesced_reads_.Clear();
+        return access_state_maps_[static_cast<size_t>(type)];
+    }
     const ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) const {
         return access_state_maps_[static_cast<size_t>(type)];
     }
@@ -990,15 +1077,48 @@ class AccessContext {
                                    uint32_t subpass) const;
 
     void SetStartTag(ResourceUsageTag tag) { start_tag_ = tag; }
+    // Counters for the syncval_stats setting, owned by the device's SyncValidator. Reset() leaves them bound.
+    void SetStats(SyncStats *stats) { stats_ = stats; }
+    SyncStats *GetStats() const { return stats_; }
+    void CountBarrierApplications(uint64_t count) const;
     template <typename Action>
     void ForAll(Action &&action);
+    // Merge abutting equal access states, so map size tracks the live working set after waits retire accesses
+    void Consolidate();
+    void GatherReferencedTags(ResourceUsageTagSet &used) const;
 
     // For use during queue submit building up the QueueBatchContext AccessContext for validation, otherwise clear.
     void AddAsyncContext(const AccessContext *context);
     // For use during queue submit to avoid stale pointers;
-    void ClearAsyncContext(const AccessContext *context) { async_.clear(); }
+    void ClearAsyncContexts() { async_.clear(); }
 
   private:
+    // Recently recorded hazard free reads of linear (buffer) address ranges, see IsCoalescedRead
+    class CoalescedReads {
+      public:
+        CoalescedReads() = default;
+        // Copies of a context are resolved and updated independently of the original, so they start out empty.
+        CoalescedReads(const CoalescedReads &) {}
+        CoalescedReads &operator=(const CoalescedReads &) {
+            Clear();
+            return *this;
+        }
+        bool Contains(SyncStageAccessIndex read_index, const ResourceAccessRange &range) const;
+        void Insert(SyncStageAccessIndex read_index, const ResourceAccessRange &range);
+        void Invalidate(const ResourceAccessRange &range);
+        void Clear() { size_ = 0; }
+
+      private:
+        struct Read {
+            SyncStageAccessIndex read_index;
+            ResourceAccessRange range;
+        };
+        static constexpr size_t kMaxReads = 8;
+        std::array<Read, kMaxReads> reads_;
+        size_t size_ = 0;
+        size_t next_replace_ = 0;
+    };
+
     template <typename Detector>
     HazardResult DetectHazard(AccessAddressType type, Detector &detector, const ResourceAccessRange &range,
                               DetectOptions options) const;
@@ -1016,6 +1136,8 @@ class AccessContext {
     TrackBack *src_external_;
     TrackBack dst_external_;
     ResourceUsageTag start_tag_;
+    CoalescedReads coalesced_reads_;
+    SyncStats *stats_ = nullptr;
 };
 
 struct SyncEventState {
@@ -1066,6 +1188,7 @@ class SyncEventsContext {
         const auto find_it = map_.find(event_state.get());
         if (find_it == map_.end()) {
             if (!event_state.get()) return nullptr;
+            RemoveDestroyed();
 
             const auto *event_plain_ptr = event_state.get();
             auto sync_state = std::make_shared<SyncEventState>(event_state);
@@ -1086,6 +1209,7 @@ class SyncEventsContext {
 
     void ApplyBarrier(const SyncExecScope &src, const SyncExecScope &dst, ResourceUsageTag tag);
     void ApplyTaggedWait(VkQueueFlags queue_flags, ResourceUsageTag tag);
+    void GatherReferencedTags(ResourceUsageTagSet &used) const;
 
     // stl style naming for range-for support
     inline iterator begin() { return map_.begin(); }
@@ -1093,13 +1217,10 @@ class SyncEventsContext {
     inline iterator end() { return map_.end(); }
     inline const_iterator end() const { return map_.end(); }
 
-    void Destroy(const EVENT_STATE *event_state) {
-        auto sync_it = map_.find(event_state);
-        if (sync_it != map_.end()) {
-            sync_it->second->destroyed = true;
-            map_.erase(sync_it);
-        }
-    }
+    // vkDestroyEvent can't update the contexts of command buffers recording on other threads, so destroyed events are dropped
+    // lazily by the thread owning the context: when it inserts an event, waits on events, or waits for the host, and when the
+    // context is reset. The entries hold a reference to the EVENT_STATE, so the key isn't reused meanwhile.
+    void RemoveDestroyed();
     void Clear() { map_.clear(); }
 
     SyncEventsContext &DeepCopy(const SyncEventsContext &from);
@@ -1190,22 +1311,7 @@ class CommandBufferAccessContext : public CommandExecutionContext {
         SyncOpEntry(const SyncOpEntry &other) = default;
     };
 
-    CommandBufferAccessContext(const SyncValidator *sync_validator = nullptr)
-        : CommandExecutionContext(sync_validator),
-          cb_state_(),
-          queue_flags_(),
-          destroyed_(false),
-          access_log_(),
-          cbs_referenced_(),
-          command_number_(0),
-          subcommand_number_(0),
-          reset_count_(0),
-          cb_access_context_(),
-          current_context_(&cb_access_context_),
-          events_context_(),
-          render_pass_contexts_(),
-          current_renderpass_context_(),
-          sync_ops_() {}
+    CommandBufferAccessContext(const SyncValidator *sync_validator = nullptr);
     CommandBufferAccessContext(SyncValidator &sync_validator, std::shared_ptr<CMD_BUFFER_STATE> &cb_state, VkQueueFlags queue_flags)
         : CommandBufferAccessContext(&sync_validator) {
         cb_state_ = cb_state;
@@ -1234,6 +1340,22 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     }
     void MarkDestroyed() { destroyed_ = true; }
     bool IsDestroyed() const { return destroyed_; }
+    // A freed context is pooled without its command buffer, and rebound to the next one allocated, retaining the capacity of its
+    // containers. Only valid for (reset) contexts not referenced by any queue batch.
+    void Unbind() {
+        assert(access_log_.empty());
+        cb_state_.reset();
+    }
+    void Rebind(const std::shared_ptr<CMD_BUFFER_STATE> &cb_state, VkQueueFlags queue_flags) {
+        assert(!cb_state_);
+        cb_state_ = cb_state;
+        queue_flags_ = queue_flags;
+        destroyed_ = false;
+        // Usage records and messages must not carry the counts of the previous command buffer
+        command_number_ = 0;
+        subcommand_number_ = 0;
+        reset_count_ = 0;
+    }
 
     std::string FormatUsage(ResourceUsageTag tag) const override;
     std::string FormatUsage(const ResourceFirstAccess &access) const;  //  Only command buffers have "first usage"
@@ -1258,7 +1380,6 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     void RecordDrawSubpassAttachment(ResourceUsageTag tag);
     ResourceUsageTag RecordNextSubpass(CMD_TYPE cmd_type);
     ResourceUsageTag RecordEndRenderPass(CMD_TYPE cmd_type);
-    void RecordDestroyEvent(VkEvent event);
 
     bool ValidateFirstUse(CommandExecutionContext *proxy_context, const char *func_name, uint32_t index) const;
     void RecordExecutedCommandBuffer(const CommandBufferAccessContext &recorded_context);
@@ -1298,6 +1419,16 @@ class CommandBufferAccessContext : public CommandExecutionContext {
         RecordSyncOp(std::move(sync_op));  // Call the non-template version
     }
     const AccessLog &GetAccessLog() const { return access_log_; }
+    // The command buffer level context, and the subpass contexts of every render pass instance recorded since the last reset
+    template <typename Action>
+    void ForEachAccessContext(Action &&action) const {
+        action(cb_access_context_);
+        for (const auto &rp_context : render_pass_contexts_) {
+            for (const auto &subpass_context : rp_context.GetContexts()) {
+                action(subpass_context);
+            }
+        }
+    }
     void InsertRecordedAccessLogEntries(const CommandBufferAccessContext &cb_context) override;
     const std::vector<SyncOpEntry> &GetSyncOps() const { return sync_ops_; };
 
@@ -1358,16 +1489,24 @@ class AccessLogger {
         BatchLog &operator=(BatchLog &&other) = default;
         BatchLog(const BatchRecord &batch) : batch_(batch) {}
 
-        size_t Size() const { return log_.size(); }
+        // Size is the number of tags covered by the batch, RecordCount the number of records actually retained
+        size_t Size() const { return size_; }
+        size_t RecordCount() const { return log_.size(); }
+        size_t MemoryUsage() const;
         const BatchRecord &GetBatch() const { return batch_; }
         AccessRecord operator[](size_t index) const;
 
         void Append(const CommandExecutionContext::AccessLog &other);
+        // Retain only the records at the given (sorted, batch relative) indices, and the command buffers they reference
+        void Compact(const std::vector<size_t> &retained);
 
       private:
         BatchRecord batch_;
         layer_data::unordered_set<std::shared_ptr<const CMD_BUFFER_STATE>> cbs_referenced_;
         CommandExecutionContext::AccessLog log_;
+        size_t size_ = 0;
+        // Empty unless compacted, in which case log_[i] is the record for batch relative index retained_index_[i]
+        std::vector<size_t> retained_index_;
     };
 
     using AccessLogRangeMap = sparse_container::range_map<ResourceUsageTag, BatchLog>;
@@ -1378,6 +1517,11 @@ class AccessLogger {
     BatchLog *AddBatch(const QueueSyncState *queue_state, uint64_t submit_id, uint32_t batch_id, const ResourceUsageRange &range);
     void MergeMove(AccessLogger &&child);
     void Reset();
+    // Drop the BatchLogs no referenced tag refers to, and compact the rest down to the referenced records
+    void Trim(const ResourceUsageTagSet &used);
+    size_t RecordCount() const;
+    // Approximate bytes held by the retained records
+    size_t MemoryUsage() const;
 
   private:
     const AccessLogger *prev_;
@@ -1437,6 +1581,7 @@ class QueueBatchContext : public CommandExecutionContext {
 
     QueueBatchContext(const SyncValidator &sync_state, const QueueSyncState &queue_state);
     QueueBatchContext() = delete;
+    ~QueueBatchContext();
 
     template <typename BatchInfo>
     void Setup(const std::shared_ptr<const QueueBatchContext> &prev_batch, const BatchInfo &batch_info,
@@ -1451,6 +1596,9 @@ class QueueBatchContext : public CommandExecutionContext {
 
     void ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag);
     void ApplyDeviceWait();
+    // Release the submit time only state (command buffers and async batches) of a batch conserved past its submit.
+    void TrimSubmitState();
+    void GatherReferencedTags(ResourceUsageTagSet &used) const;
 
   private:
     // The BatchInfo is either the Submit or Submit2 version with traits allowing generic acces
@@ -1462,7 +1610,7 @@ class QueueBatchContext : public CommandExecutionContext {
     template <typename BatchInfo>
     void SetupCommandBufferInfo(const BatchInfo &batch_info);
 
-    std::shared_ptr<QueueBatchContext> ResolveOneWaitSemaphore(VkSemaphore sem, VkPipelineStageFlags2 wait_mask,
+    std::shared_ptr<QueueBatchContext> ResolveOneWaitSemaphore(VkSemaphore sem, VkPipelineStageFlags2 wait_mask, uint64_t value,
                                                                SignaledSemaphores &signaled);
 
     const QueueSyncState *queue_state_ = nullptr;
@@ -1477,6 +1625,8 @@ class QueueBatchContext : public CommandExecutionContext {
     // When null use the global logger
     AccessLogger *logger_ = nullptr;
     AccessLogger::BatchLog *batch_log_ = nullptr;
+    // Only set when collecting statistics
+    std::chrono::steady_clock::time_point created_;
 };
 
 class QueueSyncState {
@@ -1510,20 +1660,71 @@ class QueueSyncState {
     QueueId id_;
 };
 
+// Internal counters for the syncval_stats setting, one set per device. Map sizes and memory use are gathered when the
+// statistics are reported.
+class SyncStats {
+  public:
+    std::atomic<uint64_t> commands{0};
+    std::atomic<uint64_t> hazard_checks{0};
+    std::atomic<uint64_t> barrier_applications{0};
+    std::atomic<uint64_t> queue_submits{0};
+    std::atomic<uint64_t> batches_created{0};
+    std::atomic<uint64_t> batches_destroyed{0};
+    std::atomic<uint64_t> batch_lifetime_us{0};  // Summed over the destroyed batches
+
+    // Only set at device creation, before any command can be counted
+    void Enable() { enabled_ = true; }
+    bool Enabled() const { return enabled_; }
+    void Add(std::atomic<uint64_t> &counter, uint64_t value = 1) {
+        if (enabled_) counter.fetch_add(value, std::memory_order_relaxed);
+    }
+
+  private:
+    bool enabled_ = false;
+};
+
 class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
   public:
     using StateTracker = ValidationStateTracker;
     SyncValidator() { container_type = LayerObjectTypeSyncValidation; }
     virtual ~SyncValidator() { ResetCommandBufferCallbacks(); };
 
+    ReadLockGuard ReadLock() override;
+    WriteLockGuard WriteLock() override;
+
     // Global tag range for submitted command buffers resource usage logs
     mutable std::atomic<ResourceUsageTag> tag_limit_{0};  // This is reserved in Validation phase, thus mutable and atomic
     ResourceUsageRange ReserveGlobalTagRange(size_t tag_count) const;  // Note that the tag_limit_ is mutable this has side effects
     // This is a snapshot value only
     AccessLogger global_access_log_;
-
+    // Retention budget (in records) for the global access log, zero trims only at queue/device wait idle. Like report_stats_,
+    // read at instance creation and inherited by each device.
+    static constexpr size_t kDefaultAccessLogLimit = 1U << 18;
+    size_t access_log_limit_ = kDefaultAccessLogLimit;
+    size_t access_log_trim_threshold_ = kDefaultAccessLogLimit;
+    void TrimAccessLog();
+
+    // Set by the syncval_stats setting, reported at vkDeviceWaitIdle and vkDestroyDevice, and every stats_report_interval_
+    // queue submissions if the syncval_stats_interval setting is non-zero
+    bool report_stats_ = false;
+    uint64_t stats_report_interval_ = 0;
+    static constexpr size_t kStatsLargestResources = 8;
+    // Declared ahead of the contexts that count into it, which must not outlive it
+    mutable SyncStats stats_;
+    SyncStats *GetStats() const { return &stats_; }
+    void ReportStats(bool include_command_buffers);
+
+    // With fine grained locking, the contents of each CommandBufferAccessContext are covered by the application's external
+    // synchronization of the command buffer, only the map itself needs a lock
+    mutable ReadWriteLock cb_access_state_lock_;
     layer_data::unordered_map<VkCommandBuffer, std::shared_ptr<CommandBufferAccessContext>> cb_access_state;
+    // Contexts of freed command buffers, reused by the next command buffers allocated. Guarded by cb_access_state_lock_.
+    static constexpr size_t kMaxPooledAccessContexts = 64;
+    std::vector<std::shared_ptr<CommandBufferAccessContext>> cb_access_context_pool_;
 
+    // Guards the queue last batches, signaled semaphores, and global access log. Shared during submit validation, exclusive when
+    // updated at submit record or wait idle.  queue_sync_states_ itself is immutable after CreateDevice.
+    mutable ReadWriteLock queue_sync_lock_;
     using QueueSyncStatesMap = layer_data::unordered_map<VkQueue, std::shared_ptr<QueueSyncState>>;
     layer_data::unordered_map<VkQueue, std::shared_ptr<QueueSyncState>> queue_sync_states_;
     SignaledSemaphores signaled_semaphores_;
@@ -1546,6 +1747,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     QueueBatchContext::BatchSet GetQueueLastBatchSnapshot() { return GetQueueLastBatchSnapshot(QueueBatchContext::TruePred); };
 
     std::shared_ptr<CommandBufferAccessContext> AccessContextFactory(VkCommandBuffer command_buffer);
+    // The plain pointers are only valid while the application synchronizes access to the command buffer, as freeing it (which
+    // must not run concurrently with any other use) releases or recycles the context. Use GetAccessContextShared to retain it.
     CommandBufferAccessContext *GetAccessContext(VkCommandBuffer command_buffer);
     CommandBufferAccessContext *GetAccessContextNoInsert(VkCommandBuffer command_buffer);
     const CommandBufferAccessContext *GetAccessContext(VkCommandBuffer command_buffer) const;
@@ -1561,6 +1764,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     void RecordCmdEndRenderPass(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo, CMD_TYPE cmd_type);
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
+    void PostCallRecordCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                      VkInstance *pInstance, VkResult result) override;
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo) override;
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
@@ -1581,7 +1786,6 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     void PreCallRecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
                                     const VkBufferCopy *pRegions) override;
 
-    void PreCallRecordDestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) override;
     bool PreCallValidateCmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2KHR *pCopyBufferInfos) const override;
     bool PreCallValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfos) const override;
     bool ValidateCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfos, CMD_TYPE cmd_type) const;
@@ -1909,6 +2113,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                          const VkCommandBuffer *pCommandBuffers) override;
     void PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) override;
     void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) override;
+    void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) override;
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                     VkFence fence) const override;
     void PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
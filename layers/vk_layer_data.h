@@ -23,10 +23,12 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <atomic>
 #include <cassert>
 #include <limits>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <set>
 #include <algorithm>
@@ -695,37 +697,71 @@ class small_unordered_map
 template <typename Key, int N = 1>
 class small_unordered_set : public small_container<Key, Key, layer_data::unordered_set<Key>, value_type_helper_set<Key>, N> {};
 
+// Guards lookup, insertion and removal in the layer data maps of a given DATA_T. Code iterating a map must hold it too.
+template <typename DATA_T>
+std::mutex &LayerDataMapLock() {
+    static std::mutex lock;
+    return lock;
+}
+
+// Bumped whenever a layer data entry of a given DATA_T is freed, invalidating the per-thread lookup caches
+template <typename DATA_T>
+std::atomic<uint64_t> &LayerDataMapGeneration() {
+    static std::atomic<uint64_t> generation(1);
+    return generation;
+}
+
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
-    /* TODO: We probably should lock here, or have caller lock */
-    DATA_T *&got = layer_data_map[data_key];
-
-    if (got == nullptr) {
-        got = new DATA_T;
+    // Nearly every API call looks up the same dispatch key as the previous call on the same thread, so a one entry per-thread
+    // cache answers those without touching the map or its lock. Freeing any entry changes the generation, dropping every
+    // cached entry, so a cache never returns freed (or reused dispatch key) layer data.
+    struct CacheEntry {
+        const void *map;
+        void *key;
+        DATA_T *data;
+        uint64_t generation;
+    };
+    static thread_local CacheEntry cache = {nullptr, nullptr, nullptr, 0};
+    const uint64_t generation = LayerDataMapGeneration<DATA_T>().load(std::memory_order_acquire);
+    if ((cache.key == data_key) && (cache.map == &layer_data_map) && (cache.generation == generation)) {
+        return cache.data;
+    }
+
+    DATA_T *got = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(LayerDataMapLock<DATA_T>());
+        DATA_T *&entry = layer_data_map[data_key];
+        if (entry == nullptr) {
+            entry = new DATA_T;
+        }
+        got = entry;
     }
+    cache = {&layer_data_map, data_key, got, generation};
 
     return got;
 }
 
 template <typename DATA_T>
 void FreeLayerDataPtr(void *data_key, small_unordered_map<void *, DATA_T *, 2> &layer_data_map) {
-    delete layer_data_map[data_key];
-    layer_data_map.erase(data_key);
+    DATA_T *data = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(LayerDataMapLock<DATA_T>());
+        LayerDataMapGeneration<DATA_T>().fetch_add(1, std::memory_order_acq_rel);
+        data = layer_data_map[data_key];
+        layer_data_map.erase(data_key);
+    }
+    delete data;
 }
 
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    DATA_T *debug_data;
-    /* TODO: We probably should lock here, or have caller lock */
-    auto got = layer_data_map.find(data_key);
-
-    if (got == layer_data_map.end()) {
+    std::lock_guard<std::mutex> lock(LayerDataMapLock<DATA_T>());
+    DATA_T *&debug_data = layer_data_map[data_key];
+    if (debug_data == nullptr) {
         debug_data = new DATA_T;
-        layer_data_map[(void *)data_key] = debug_data;
-    } else {
-        debug_data = got->second;
     }
 
     return debug_data;
@@ -733,11 +769,15 @@ DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &la
 
 template <typename DATA_T>
 void FreeLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    auto got = layer_data_map.find(data_key);
-    assert(got != layer_data_map.end());
-
-    delete got->second;
-    layer_data_map.erase(got);
+    DATA_T *data = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(LayerDataMapLock<DATA_T>());
+        auto got = layer_data_map.find(data_key);
+        assert(got != layer_data_map.end());
+        data = got->second;
+        layer_data_map.erase(got);
+    }
+    delete data;
 }
 
 namespace layer_data {
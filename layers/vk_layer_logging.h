@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -202,6 +203,9 @@ typedef struct _debug_report_data {
     mutable std::mutex debug_output_mutex;
     int32_t duplicate_message_limit = 0;
     mutable layer_data::unordered_map<uint32_t, int32_t> duplicate_message_count_map{};
+    // Incremented for every message a validation object attempts to log, whether or not it is filtered out. Lets callers tell
+    // if a check ran clean without hooking the callbacks.
+    mutable std::atomic<uint64_t> log_msg_request_count{0};
     const void *instance_pnext_chain{};
     bool forceDefaultLogCallback{false};
 
@@ -663,6 +667,7 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
 static inline bool LogMsgEnabled(const debug_report_data *debug_data, const std::string &vuid_text,
                                  VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
+    debug_data->log_msg_request_count.fetch_add(1, std::memory_order_relaxed);
     if (!(debug_data->active_severities & severity) || !(debug_data->active_types & type)) {
         return false;
     }
@@ -418,6 +418,7 @@ class LockedSharedPtr : public std::shared_ptr<T> {
 // contains: Returns true if the key is in the map.
 // find: Returns != end() if found, value is in ret->second.
 // pop: Erases and returns the erased value if found.
+// erase_batch: Erases a collection of keys, taking each bucket lock once. Returns the number erased.
 //
 // find/end: find returns a vaguely iterator-like type that can be compared to
 // end and can use iter->second to retrieve the reference. This is to ease porting
@@ -456,6 +457,24 @@ class vl_concurrent_unordered_map {
         return maps[h].erase(key);
     }
 
+    // Erase a batch of keys, taking each bucket lock once instead of once per key. Returns the number of keys erased.
+    template <typename Container>
+    size_t erase_batch(const Container &keys) {
+        std::vector<Key> bucket_keys[BUCKETS];
+        for (const auto &key : keys) {
+            bucket_keys[ConcurrentMapHashObject(key)].emplace_back(key);
+        }
+        size_t erased = 0;
+        for (int h = 0; h < BUCKETS; ++h) {
+            if (bucket_keys[h].empty()) continue;
+            WriteLockGuard lock(locks[h].lock);
+            for (const auto &key : bucket_keys[h]) {
+                erased += maps[h].erase(key);
+            }
+        }
+        return erased;
+    }
+
     bool contains(const Key &key) const {
         uint32_t h = ConcurrentMapHashObject(key);
         ReadLockGuard lock(locks[h].lock);
@@ -283,6 +283,14 @@ class ParameterValidationOutputGenerator(OutputGenerator):
             'vkExportMetalObjectsEXT',
             ]
 
+        # These functions take a (pCreateInfo, pAllocator, pObject) triple whose create info is keyed by its bytes in
+        # StatelessValidation::create_info_memo, so a create info that already validated clean skips the checks.
+        # Only add create infos (and accepted pNext structs) that contain no pointers other than pNext, see CreateInfoMemo.
+        self.memoized_create_functions = [
+            'vkCreateSampler',
+            'vkCreateImageView',
+            ]
+
         # Commands to ignore
         self.blacklist = [
             'vkGetInstanceProcAddr',
@@ -855,7 +863,7 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                     enum_entry = '#ifdef %s\n' % self.featureExtraProtect
                 else:
                     enum_entry = ''
-                enum_entry += 'const std::vector<%s> All%sEnums = {' % (groupName, groupName)
+                enum_entry += 'const ValidEnumValues<%s> All%sEnums = {' % (groupName, groupName)
                 for enum in groupElem:
                     name = enum.get('name')
                     if name is not None and enum.get('supported') != 'disabled':
@@ -1165,22 +1173,20 @@ class ParameterValidationOutputGenerator(OutputGenerator):
     # Generate pNext check string
     def makeStructNextCheck(self, prefix, value, funcPrintName, valuePrintName, postProcSpec, struct_type_name):
         checkExpr = []
-        # Generate an array of acceptable VkStructureType values for pNext
-        extStructCount = 0
-        extStructVar = 'NULL'
+        # Generate a hash set (AllowedStructTypes) of the acceptable VkStructureType values for pNext
+        extStructVar = 'StructTypeLookup()'
         extStructNames = 'NULL'
         pNextVuid = self.GetVuid(struct_type_name, "pNext-pNext")
         sTypeVuid = self.GetVuid(struct_type_name, "sType-unique")
         if value.extstructs:
             extStructVar = 'allowed_structs_{}'.format(struct_type_name)
-            extStructCount = 'ARRAY_SIZE({})'.format(extStructVar)
             if struct_type_name == 'VkInstanceCreateInfo':
                 value.extstructs.append('VkInstanceLayerSettingsEXT')
                 self.structTypes['VkInstanceLayerSettingsEXT'] = 'static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT)'
             extStructNames = '"' + ', '.join(value.extstructs) + '"'
-            checkExpr.append('const VkStructureType {}[] = {{ {} }};\n'.format(extStructVar, ', '.join([self.structTypes[s] for s in value.extstructs])))
-        checkExpr.append('skip |= validate_struct_pnext("{}", {ppp}"{}"{pps}, {}, {}{}, {}, {}, GeneratedVulkanHeaderVersion, {}, {});\n'.format(
-            funcPrintName, valuePrintName, extStructNames, prefix, value.name, extStructCount, extStructVar, pNextVuid, sTypeVuid, **postProcSpec))
+            checkExpr.append('static const AllowedStructTypes<{}> {}({{ {} }});\n'.format(len(value.extstructs), extStructVar, ', '.join([self.structTypes[s] for s in value.extstructs])))
+        checkExpr.append('skip |= validate_struct_pnext("{}", {ppp}"{}"{pps}, {}, {}{}, {}, GeneratedVulkanHeaderVersion, {}, {});\n'.format(
+            funcPrintName, valuePrintName, extStructNames, prefix, value.name, extStructVar, pNextVuid, sTypeVuid, **postProcSpec))
         return checkExpr
     #
     # Generate the pointer check string
@@ -1590,6 +1596,9 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                     version_flag = command.promotion_info[1]
                     version_id = version_flag.replace('VK_VERSION', 'VK_API_VERSION')
                     cmdDef += '%s if (CheckPromotedApiAgainstVulkanVersion(%s, "%s", %s)) return true;\n' % (indent, command.promotion_info[0], command.name, version_id)
+                if command.name in self.memoized_create_functions:
+                    cmdDef += '%sconst auto memo_ticket = create_info_memo.Lookup(report_data, %s, %s, %s);\n' % (indent, command.params[1].name, command.params[2].name, command.params[3].name)
+                    cmdDef += '%sif (memo_ticket.hit) return skip;\n' % indent
                 for line in lines:
                     if type(line) is list:
                         for sub in line:
@@ -1604,6 +1613,8 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                         params_text += '%s, ' % param.name
                     params_text = params_text[:-2] + ');\n'
                     cmdDef += '    if (!skip) skip |= manual_PreCallValidate'+ command.name[2:] + '(' + params_text
+                if command.name in self.memoized_create_functions:
+                    cmdDef += '%screate_info_memo.Record(report_data, memo_ticket, skip);\n' % indent
                 cmdDef += '%sreturn skip;\n' % indent
                 cmdDef += '}\n'
                 self.validation.append(cmdDef)
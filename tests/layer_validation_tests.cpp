@@ -3597,15 +3597,27 @@ void VkSyncValTest::InitSyncValFramework(bool enable_queue_submit_validation) {
     qs_setting_string_value.arrayString.count = strlen(qs_setting_string_value.arrayString.pCharArray);
     VkLayerSettingValueEXT qs_enable_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT,
                                                     qs_setting_string_value};
-    VkLayerSettingsEXT qs_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
-                                   &qs_enable_setting_val};
-
+    std::vector<VkLayerSettingValueEXT> settings = syncval_settings_;
     if (enable_queue_submit_validation) {
+        settings.push_back(qs_enable_setting_val);
+    }
+    VkLayerSettingsEXT qs_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr,
+                                   static_cast<uint32_t>(settings.size()), settings.data()};
+
+    if (!settings.empty()) {
         features_.pNext = &qs_settings;
     }
     InitFramework(m_errorMonitor, &features_);
 }
 
+void VkSyncValTest::AddSyncValSetting(const char *name, VkLayerSettingValueTypeEXT type, const VkLayerSettingValueDataEXT &data) {
+    VkLayerSettingValueEXT setting{};
+    strncpy(setting.name, name, sizeof(setting.name) - 1);
+    setting.type = type;
+    setting.data = data;
+    syncval_settings_.push_back(setting);
+}
+
 void print_android(const char *c) {
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
     __android_log_print(ANDROID_LOG_INFO, "VulkanLayerValidationTests", "%s", c);
@@ -355,8 +355,11 @@ class VkDebugPrintfTest : public VkLayerTest {
 class VkSyncValTest : public VkLayerTest {
   public:
     void InitSyncValFramework(bool enable_queue_submit_validation = false);
+    // For the syncval settings only read at instance creation, must precede InitSyncValFramework
+    void AddSyncValSetting(const char *name, VkLayerSettingValueTypeEXT type, const VkLayerSettingValueDataEXT &data);
 
   protected:
+    std::vector<VkLayerSettingValueEXT> syncval_settings_;
     VkValidationFeatureEnableEXT enables_[1] = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
     VkValidationFeatureDisableEXT disables_[4] = {
         VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT, VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT,
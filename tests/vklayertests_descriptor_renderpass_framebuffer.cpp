@@ -7776,6 +7776,140 @@ TEST_F(VkLayerTest, InvalidPushDescriptorImageLayout) {
     vk::DestroySampler(m_device->device(), sampler, NULL);
 }
 
+TEST_F(VkLayerTest, PushDescriptorSetRecycledLayout) {
+    TEST_DESCRIPTION("Push with set layout A, then B, then A again, leaving a descriptor of A un-updated the second time.");
+
+    AddRequiredExtensions(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+
+    auto push_descriptor_prop = GetPushDescriptorProperties(instance(), gpu());
+    if (push_descriptor_prop.maxPushDescriptors < 2) {
+        GTEST_SKIP() << "maxPushDescriptors is less than 2";
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    vk_testing::Sampler sampler(*m_device, sampler_ci);
+    const VkSampler immutable_sampler = sampler.handle();
+
+    // Layout A combines an immutable sampler with a uniform buffer, layout B only has a uniform buffer
+    const VkDescriptorSetLayoutObj ds_layout_a(
+        m_device,
+        {{0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, &immutable_sampler},
+         {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}},
+        VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+    const VkDescriptorSetLayoutObj ds_layout_b(m_device,
+                                               {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}},
+                                               VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR);
+    const VkPipelineLayoutObj pipeline_layout_a(m_device, {&ds_layout_a});
+    const VkPipelineLayoutObj pipeline_layout_b(m_device, {&ds_layout_b});
+
+    char const *fs_source_a = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform sampler2D tex;
+        layout(set=0, binding=1) uniform UBO { vec4 scale; } ubo;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = textureLod(tex, vec2(0.5, 0.5), 0.0) * ubo.scale;
+        }
+    )glsl";
+    char const *fs_source_b = R"glsl(
+        #version 450
+        layout(set=0, binding=0) uniform UBO { vec4 color; } ubo;
+        layout(location=0) out vec4 color;
+        void main(){
+           color = ubo.color;
+        }
+    )glsl";
+    VkShaderObj vs(this, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs_a(this, fs_source_a, VK_SHADER_STAGE_FRAGMENT_BIT);
+    VkShaderObj fs_b(this, fs_source_b, VK_SHADER_STAGE_FRAGMENT_BIT);
+
+    VkPipelineObj pipe_a(m_device);
+    pipe_a.SetViewport(m_viewports);
+    pipe_a.SetScissor(m_scissors);
+    pipe_a.AddShader(&vs);
+    pipe_a.AddShader(&fs_a);
+    pipe_a.AddDefaultColorAttachment();
+    pipe_a.CreateVKPipeline(pipeline_layout_a.handle(), m_renderPass);
+
+    VkPipelineObj pipe_b(m_device);
+    pipe_b.SetViewport(m_viewports);
+    pipe_b.SetScissor(m_scissors);
+    pipe_b.AddShader(&vs);
+    pipe_b.AddShader(&fs_b);
+    pipe_b.AddDefaultColorAttachment();
+    pipe_b.CreateVKPipeline(pipeline_layout_b.handle(), m_renderPass);
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_B8G8R8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    ASSERT_TRUE(image.initialized());
+    image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    VkImageView image_view = image.targetView(VK_FORMAT_B8G8R8A8_UNORM);
+
+    VkBufferObj buffer;
+    buffer.init(*m_device, 16, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+    // The sampler of the image info is ignored, as binding 0 of layout A has an immutable sampler
+    VkDescriptorImageInfo image_info = {VK_NULL_HANDLE, image_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    VkDescriptorBufferInfo buffer_info = {buffer.handle(), 0, VK_WHOLE_SIZE};
+
+    VkWriteDescriptorSet writes[2] = {LvlInitStruct<VkWriteDescriptorSet>(), LvlInitStruct<VkWriteDescriptorSet>()};
+    writes[0].dstBinding = 0;
+    writes[0].descriptorCount = 1;
+    writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writes[0].pImageInfo = &image_info;
+    writes[1].dstBinding = 1;
+    writes[1].descriptorCount = 1;
+    writes[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    writes[1].pBufferInfo = &buffer_info;
+
+    VkWriteDescriptorSet write_b = LvlInitStruct<VkWriteDescriptorSet>();
+    write_b.dstBinding = 0;
+    write_b.descriptorCount = 1;
+    write_b.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    write_b.pBufferInfo = &buffer_info;
+
+    auto vkCmdPushDescriptorSetKHR =
+        (PFN_vkCmdPushDescriptorSetKHR)vk::GetDeviceProcAddr(m_device->device(), "vkCmdPushDescriptorSetKHR");
+    ASSERT_NE(vkCmdPushDescriptorSetKHR, nullptr);
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+
+    // Fully updated push with layout A
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_a.handle());
+    vkCmdPushDescriptorSetKHR(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout_a.handle(), 0, 2,
+                              writes);
+    m_commandBuffer->Draw(3, 1, 0, 0);
+
+    // Layout B disturbs the push descriptor set of A
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_b.handle());
+    vkCmdPushDescriptorSetKHR(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout_b.handle(), 0, 1,
+                              &write_b);
+    m_commandBuffer->Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Back to layout A, only writing binding 0. The set recycled for A must still have its immutable sampler, but not the
+    // uniform buffer of the first push.
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe_a.handle());
+    vkCmdPushDescriptorSetKHR(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout_a.handle(), 0, 1,
+                              writes);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "binding #1 index 0 is being used in draw but has never been updated");
+    m_commandBuffer->Draw(3, 1, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(VkLayerTest, PushDescriptorSetLayoutWithoutExtension) {
     TEST_DESCRIPTION("Create a push descriptor set layout without loading the needed extension.");
     ASSERT_NO_FATAL_FAILURE(Init());
@@ -23,6 +23,7 @@
  * Author: Shannon McPherson <shannon@lunarg.com>
  * Author: John Zulauf <jzulauf@lunarg.com>
  */
+#include <atomic>
 #include <type_traits>
 
 #include "cast_utils.h"
@@ -4294,6 +4295,82 @@ TEST_F(VkSyncValTest, StageAccessExpansion) {
     m_errorMonitor->VerifyNotFound();
 }
 
+TEST_F(VkSyncValTest, SyncRepeatedVertexReads) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    const float vbo_data[3] = {1.f, 0.f, 1.f};
+    VkVertexInputAttributeDescription VertexInputAttributeDescription = {0, 0, VK_FORMAT_R32G32B32_SFLOAT, sizeof(vbo_data)};
+    VkVertexInputBindingDescription VertexInputBindingDescription = {0, sizeof(vbo_data), VK_VERTEX_INPUT_RATE_VERTEX};
+    VkBufferObj vbo, vbo2;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    VkBufferUsageFlags buffer_usage =
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vbo.init(*m_device, vbo.create_info(sizeof(vbo_data), buffer_usage, nullptr), mem_prop);
+    vbo2.init(*m_device, vbo2.create_info(sizeof(vbo_data), buffer_usage, nullptr), mem_prop);
+
+    CreatePipelineHelper g_pipe(*this);
+    g_pipe.InitInfo();
+    g_pipe.InitState();
+    g_pipe.vi_ci_.pVertexBindingDescriptions = &VertexInputBindingDescription;
+    g_pipe.vi_ci_.vertexBindingDescriptionCount = 1;
+    g_pipe.vi_ci_.pVertexAttributeDescriptions = &VertexInputAttributeDescription;
+    g_pipe.vi_ci_.vertexAttributeDescriptionCount = 1;
+    ASSERT_VK_SUCCESS(g_pipe.CreateGraphicsPipeline());
+
+    VkDeviceSize offset = 0;
+    VkViewport viewport = {0, 0, 16, 16, 0, 1};
+    VkRect2D scissor = {{0, 0}, {16, 16}};
+    VkBufferCopy buffer_region = {0, 0, sizeof(vbo_data)};
+    auto draw_pass = [&](uint32_t draw_count) {
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindVertexBuffers(m_commandBuffer->handle(), 0, 1, &vbo.handle(), &offset);
+        vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+        vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+        vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, g_pipe.pipeline_);
+        for (uint32_t i = 0; i < draw_count; ++i) {
+            vk::CmdDraw(m_commandBuffer->handle(), 1, 0, 0, 0);
+        }
+        m_commandBuffer->EndRenderPass();
+    };
+
+    // Repeated reads of the same vertex range are still tracked
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    draw_pass(3);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_READ");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), vbo2.handle(), vbo.handle(), 1, &buffer_region);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    // A barrier between repeated reads must not hide the reads following it
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->reset();
+    m_commandBuffer->begin();
+    draw_pass(1);
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                           nullptr, 0, nullptr, 0, nullptr);
+    draw_pass(2);
+    m_errorMonitor->VerifyNotFound();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_READ");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), vbo2.handle(), vbo.handle(), 1, &buffer_region);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    // Protected by a barrier following the last read, the write is safe
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->reset();
+    m_commandBuffer->begin();
+    draw_pass(2);
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0,
+                           nullptr, 0, nullptr, 0, nullptr);
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), vbo2.handle(), vbo.handle(), 1, &buffer_region);
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+}
+
 TEST_F(VkSyncValTest, SyncQSBufferCopyHazards) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
     ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
@@ -4492,6 +4569,9 @@ struct QSTestContext {
     void Submit1Signal(VkCommandBufferObj& cb, VkPipelineStageFlags signal_mask) {
         Submit1(cb, VK_NULL_HANDLE, 0U, semaphore.handle());
     }
+    // A zero wait_value or signal_value omits the wait or signal of the timeline semaphore
+    void SubmitTimeline(VkQueue q, VkCommandBufferObj& cb, VkSemaphore timeline, uint64_t wait_value,
+                        VkPipelineStageFlags wait_mask, uint64_t signal_value);
     void SetEvent(VkPipelineStageFlags src_mask) { event.cmd_set(*current_cb, src_mask); }
     void WaitEventBufferTransfer(VkBufferObj& buffer, VkPipelineStageFlags src_mask, VkPipelineStageFlags dst_mask) {
         std::vector<VkBufferMemoryBarrier> buffer_barriers(1, InitBufferBarrier(buffer));
@@ -4590,6 +4670,38 @@ void QSTestContext::Submit(VkQueue q, VkCommandBufferObj& cb, VkSemaphore wait,
     vk::QueueSubmit(q, 1, &submit1, VK_NULL_HANDLE);
 }
 
+void QSTestContext::SubmitTimeline(VkQueue q, VkCommandBufferObj& cb, VkSemaphore timeline, uint64_t wait_value,
+                                   VkPipelineStageFlags wait_mask, uint64_t signal_value) {
+    auto timeline_info = LvlInitStruct<VkTimelineSemaphoreSubmitInfo>();
+    auto submit1 = LvlInitStruct<VkSubmitInfo>(&timeline_info);
+    submit1.commandBufferCount = 1;
+    VkCommandBuffer h_cb = cb.handle();
+    submit1.pCommandBuffers = &h_cb;
+    if (wait_value) {
+        submit1.waitSemaphoreCount = 1;
+        submit1.pWaitSemaphores = &timeline;
+        submit1.pWaitDstStageMask = &wait_mask;
+        timeline_info.waitSemaphoreValueCount = 1;
+        timeline_info.pWaitSemaphoreValues = &wait_value;
+    }
+    if (signal_value) {
+        submit1.signalSemaphoreCount = 1;
+        submit1.pSignalSemaphores = &timeline;
+        timeline_info.signalSemaphoreValueCount = 1;
+        timeline_info.pSignalSemaphoreValues = &signal_value;
+    }
+    vk::QueueSubmit(q, 1, &submit1, VK_NULL_HANDLE);
+}
+
+static VkSemaphore CreateTimelineSemaphore(VkDeviceObj* device) {
+    auto semaphore_type_ci = LvlInitStruct<VkSemaphoreTypeCreateInfo>();
+    semaphore_type_ci.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    auto semaphore_ci = LvlInitStruct<VkSemaphoreCreateInfo>(&semaphore_type_ci);
+    VkSemaphore semaphore = VK_NULL_HANDLE;
+    vk::CreateSemaphore(device->device(), &semaphore_ci, nullptr, &semaphore);
+    return semaphore;
+}
+
 TEST_F(VkSyncValTest, SyncQSBufferCopyQSORules) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
     ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
@@ -4806,3 +4918,455 @@ TEST_F(VkSyncValTest, SyncQSOBarrierHazard) {
     test.Submit0Wait(test.cbb, VK_PIPELINE_STAGE_2_NONE);
     m_errorMonitor->VerifyNotFound();
 }
+
+TEST_F(VkSyncValTest, SyncQSConsolidatedAccessHazards) {
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    QSTestContext test(m_device);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires at least 2 TRANSFER capable queues in the same queue_family.";
+    }
+
+    // Both halves of buffer A are written by the same command, so they start out with identical state
+    const VkBufferCopy split_regions[2] = {{0, 0, 128}, {128, 128, 128}};
+    const VkBufferCopy lower_region = {0, 0, 128};
+    const VkBufferCopy upper_region = {128, 128, 128};
+
+    // Only the lower half is protected by the barrier, leaving the neighboring ranges with different barriers
+    auto lower_barrier = test.InitBufferBarrier(test.buffer_a);
+    lower_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    lower_barrier.size = 128;
+
+    m_errorMonitor->ExpectSuccess();
+    // Command Buffer A gives queue 1's batch accesses from queue 0 that the wait idle below will remove
+    test.BeginA();
+    test.CopyBToC();
+    test.End();
+
+    test.BeginB();
+    vk::CmdCopyBuffer(test.current_cb->handle(), test.buffer_b.handle(), test.buffer_a.handle(), 2, split_regions);
+    test.TransferBarrier(lower_barrier);
+    test.End();
+
+    test.Submit0Signal(test.cba);
+    test.Submit1Wait(test.cbb, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    // Removing the queue 0 accesses consolidates the remaining ranges of queue 1's batch
+    vk::QueueWaitIdle(test.q0);
+    m_errorMonitor->VerifyNotFound();
+
+    // The unprotected upper half must still hazard...
+    test.BeginA();
+    vk::CmdCopyBuffer(test.current_cb->handle(), test.buffer_c.handle(), test.buffer_a.handle(), 1, &upper_region);
+    test.End();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE_AFTER_WRITE");
+    test.Submit1(test.cba);
+    m_errorMonitor->VerifyFound();
+
+    // ... and the protected lower half must not
+    m_errorMonitor->ExpectSuccess();
+    test.BeginC();
+    vk::CmdCopyBuffer(test.current_cb->handle(), test.buffer_c.handle(), test.buffer_a.handle(), 1, &lower_region);
+    test.End();
+    test.Submit1(test.cbc);
+    m_device->wait();
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkSyncValTest, SyncQSTimelineWaitEarlierValue) {
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    if (!CheckTimelineSemaphoreSupportAndInitState(this)) {
+        GTEST_SKIP() << "Timeline semaphore not supported";
+    }
+
+    QSTestContext test(m_device);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires at least 2 TRANSFER capable queues in the same queue_family.";
+    }
+    VkSemaphore timeline = CreateTimelineSemaphore(m_device);
+    VkBufferObj buffer_d;
+    buffer_d.init_as_src_and_dst(*m_device, 256, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    m_errorMonitor->ExpectSuccess();
+    // Command Buffer A reads from buffer A and writes to buffer B, and signals value 1
+    test.BeginA();
+    test.CopyAToB();
+    test.End();
+
+    // Command Buffer B reads from buffer A and writes to buffer C, and signals value 2
+    test.BeginB();
+    test.CopyAToC();
+    test.End();
+
+    // Command Buffer C reads from buffer C and writes to buffer D
+    test.BeginC();
+    vk::CmdCopyBuffer(test.current_cb->handle(), test.buffer_c.handle(), buffer_d.handle(), 1, &test.region);
+    test.End();
+
+    test.SubmitTimeline(test.q0, test.cba, timeline, 0, 0U, 1);
+    test.SubmitTimeline(test.q0, test.cbb, timeline, 0, 0U, 2);
+    m_errorMonitor->VerifyNotFound();
+
+    // Waiting for value 1 only synchronizes with Command Buffer A, even though the signal of value 2 is pending
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-RACING-WRITE");
+    test.SubmitTimeline(test.q1, test.cbc, timeline, 1, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_errorMonitor->VerifyFound();
+
+    // The failed submit was skipped, waiting for value 2 covers the write to buffer C
+    m_errorMonitor->ExpectSuccess();
+    test.SubmitTimeline(test.q1, test.cbc, timeline, 2, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_device->wait();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroySemaphore(m_device->device(), timeline, nullptr);
+}
+
+TEST_F(VkSyncValTest, SyncQSTimelineOutOfOrderWaits) {
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    if (!CheckTimelineSemaphoreSupportAndInitState(this)) {
+        GTEST_SKIP() << "Timeline semaphore not supported";
+    }
+
+    QSTestContext test(m_device);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires at least 2 TRANSFER capable queues in the same queue_family.";
+    }
+    VkSemaphore timeline = CreateTimelineSemaphore(m_device);
+    VkCommandBufferObj cbd(m_device, &test.pool);
+    VkBufferObj buffer_d;
+    buffer_d.init_as_src_and_dst(*m_device, 256, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    m_errorMonitor->ExpectSuccess();
+    // Queue 0 writes buffer B and signals 2
+    test.BeginA();
+    test.CopyAToB();
+    test.End();
+    test.SubmitTimeline(test.q0, test.cba, timeline, 0, 0U, 2);
+
+    // Queue 1 waits for 1, which the signal of 2 is the first to reach, reads buffer B, writes buffer C, and signals 4
+    test.BeginB();
+    test.CopyBToC();
+    test.End();
+    test.SubmitTimeline(test.q1, test.cbb, timeline, 1, VK_PIPELINE_STAGE_TRANSFER_BIT, 4);
+
+    // Queue 0 waits for 3, reached by the signal of 4 from queue 1, reads buffer C and writes buffer A
+    test.BeginC();
+    test.TransferBarrier(test.buffer_a);
+    test.CopyCToA();
+    test.End();
+    test.SubmitTimeline(test.q0, test.cbc, timeline, 3, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Waiting for 1 again on queue 1 doesn't synchronize with the later write to buffer A on queue 0
+    test.Begin(cbd);
+    vk::CmdCopyBuffer(cbd.handle(), buffer_d.handle(), test.buffer_a.handle(), 1, &test.region);
+    test.End();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-RACING-WRITE");
+    test.SubmitTimeline(test.q1, cbd, timeline, 1, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    m_device->wait();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroySemaphore(m_device->device(), timeline, nullptr);
+}
+
+TEST_F(VkSyncValTest, SyncQSTimelineThirdQueueWaitsEarlierValue) {
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    if (!CheckTimelineSemaphoreSupportAndInitState(this)) {
+        GTEST_SKIP() << "Timeline semaphore not supported";
+    }
+
+    QSTestContext test(m_device);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires at least 2 TRANSFER capable queues in the same queue_family.";
+    }
+    VkQueue q2 = VK_NULL_HANDLE;
+    for (const auto* queue : m_device->dma_queues()) {
+        if ((queue->get_family_index() == test.q_fam) && (queue->handle() != test.q0) && (queue->handle() != test.q1)) {
+            q2 = queue->handle();
+            break;
+        }
+    }
+    if (q2 == VK_NULL_HANDLE) {
+        GTEST_SKIP() << "Test requires at least 3 TRANSFER capable queues in the same queue_family.";
+    }
+
+    VkSemaphore timeline = CreateTimelineSemaphore(m_device);
+    VkCommandBufferObj cbd(m_device, &test.pool);
+    VkBufferObj buffer_d;
+    buffer_d.init_as_src_and_dst(*m_device, 256, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    VkBufferObj buffer_e;
+    buffer_e.init_as_src_and_dst(*m_device, 256, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    m_errorMonitor->ExpectSuccess();
+    // Queue 0 writes buffer B and signals 1, then writes buffer C and signals 2
+    test.BeginA();
+    test.CopyAToB();
+    test.End();
+    test.BeginB();
+    test.CopyAToC();
+    test.End();
+    test.SubmitTimeline(test.q0, test.cba, timeline, 0, 0U, 1);
+    test.SubmitTimeline(test.q0, test.cbb, timeline, 0, 0U, 2);
+
+    // Queue 1 waits for 2 and reads buffer B
+    test.BeginC();
+    vk::CmdCopyBuffer(test.current_cb->handle(), test.buffer_b.handle(), buffer_d.handle(), 1, &test.region);
+    test.End();
+    test.SubmitTimeline(test.q1, test.cbc, timeline, 2, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_errorMonitor->VerifyNotFound();
+
+    // Queue 2 hasn't waited before, so the signal of 1 must still be there: waiting for 1 doesn't cover the write to buffer C
+    test.Begin(cbd);
+    vk::CmdCopyBuffer(cbd.handle(), test.buffer_c.handle(), buffer_e.handle(), 1, &test.region);
+    test.End();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-RACING-WRITE");
+    test.SubmitTimeline(q2, cbd, timeline, 1, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_errorMonitor->VerifyFound();
+
+    // The failed submit was skipped, waiting for 2 covers it
+    m_errorMonitor->ExpectSuccess();
+    test.SubmitTimeline(q2, cbd, timeline, 2, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_device->wait();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroySemaphore(m_device->device(), timeline, nullptr);
+}
+
+TEST_F(VkSyncValTest, SyncQSTimelineDestroyPendingSignal) {
+    AddRequiredExtensions(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    if (!CheckTimelineSemaphoreSupportAndInitState(this)) {
+        GTEST_SKIP() << "Timeline semaphore not supported";
+    }
+
+    QSTestContext test(m_device);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires at least 2 TRANSFER capable queues in the same queue_family.";
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    test.BeginA();
+    test.CopyAToB();
+    test.End();
+
+    test.BeginB();
+    test.CopyBToC();
+    test.End();
+
+    // Destroy the semaphore while the signal of 1 is still pending (never waited on)
+    VkSemaphore timeline = CreateTimelineSemaphore(m_device);
+    test.SubmitTimeline(test.q0, test.cba, timeline, 0, 0U, 1);
+    m_device->wait();
+    vk::DestroySemaphore(m_device->device(), timeline, nullptr);
+
+    // A new semaphore (possibly reusing the handle) must not resolve waits against the destroyed one's signal
+    timeline = CreateTimelineSemaphore(m_device);
+    test.SubmitTimeline(test.q0, test.cba, timeline, 0, 0U, 2);
+    test.SubmitTimeline(test.q1, test.cbb, timeline, 1, VK_PIPELINE_STAGE_TRANSFER_BIT, 0);
+    m_device->wait();
+    m_errorMonitor->VerifyNotFound();
+
+    vk::DestroySemaphore(m_device->device(), timeline, nullptr);
+}
+
+TEST_F(VkSyncValTest, SyncQSAccessLogLimit) {
+    TEST_DESCRIPTION("Go over syncval_access_log_limit and report a hazard against a batch kept only by a pending signal.");
+    VkLayerSettingValueDataEXT limit_value{};
+    limit_value.value32 = 1;
+    AddSyncValSetting("syncval_access_log_limit", VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT, limit_value);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    QSTestContext test(m_device);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires at least 2 TRANSFER capable queues in the same queue_family.";
+    }
+
+    VkBufferObj buffer_d;
+    buffer_d.init_as_src_and_dst(*m_device, 256, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    VkCommandBufferObj filler_cbs[4] = {{m_device, &test.pool}, {m_device, &test.pool}, {m_device, &test.pool},
+                                        {m_device, &test.pool}};
+
+    m_errorMonitor->ExpectSuccess();
+    test.BeginA();
+    test.CopyAToB();
+    test.End();
+
+    test.BeginB();
+    test.CopyCToB();
+    test.End();
+
+    // Barrier only batches, none of their records are referenced once submitted
+    for (auto &filler_cb : filler_cbs) {
+        test.Begin(filler_cb);
+        test.TransferBarrier(buffer_d);
+        test.End();
+    }
+
+    // Once the fillers replace it as the last batch of q0, only the pending signal keeps the batch of cba
+    test.Submit0Signal(test.cba);
+    for (auto &filler_cb : filler_cbs) {
+        test.Submit0(filler_cb);
+    }
+    m_errorMonitor->VerifyNotFound();
+
+    // The log went over the limit and was trimmed at the filler submits, the write of cba must still be reported in full
+    // The queue is only formatted for a prior usage found in the log
+    const char *formatted_usage = "prior_usage: SYNC_COPY_TRANSFER_WRITE, write_barriers: 0, queue: ";
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, formatted_usage);
+    test.Submit1Wait(test.cbb, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    m_errorMonitor->VerifyFound();
+
+    m_device->wait();
+}
+
+TEST_F(VkSyncValTest, SyncStatsReport) {
+    TEST_DESCRIPTION("Enable syncval_stats and check the counters reported at vkDeviceWaitIdle belong to this device only.");
+    VkLayerSettingValueDataEXT stats_value{};
+    stats_value.valueBool = VK_TRUE;
+    AddSyncValSetting("syncval_stats", VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT, stats_value);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkBufferObj buffer_c;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_c.init_as_src_and_dst(*m_device, 256, mem_prop);
+
+    VkBufferCopy region = {0, 0, 256};
+
+    m_errorMonitor->ExpectSuccess();
+    VkCommandBufferObj cba(m_device, m_commandPool);
+    cba.begin();
+    vk::CmdCopyBuffer(cba.handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    vk::CmdCopyBuffer(cba.handle(), buffer_a.handle(), buffer_c.handle(), 1, &region);
+    cba.end();
+    cba.QueueCommandBuffer(false);
+    m_errorMonitor->VerifyNotFound();
+
+    // Counters from the devices of earlier tests must not carry over
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "Commands recorded: 2,");
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyFound();
+
+    // Leave a command buffer in a render pass instance, its contexts are only sampled when the device is destroyed
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_errorMonitor->VerifyNotFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "SYNC-stats");
+    vk::DeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+    m_errorMonitor->VerifyNotFound();
+}
+
+TEST_F(VkSyncValTest, SyncStatsReportInterval) {
+    TEST_DESCRIPTION("Report syncval_stats every syncval_stats_interval queue submissions.");
+    VkLayerSettingValueDataEXT stats_value{};
+    stats_value.valueBool = VK_TRUE;
+    AddSyncValSetting("syncval_stats", VK_LAYER_SETTING_VALUE_TYPE_BOOL_EXT, stats_value);
+    VkLayerSettingValueDataEXT interval_value{};
+    interval_value.value32 = 2;
+    AddSyncValSetting("syncval_stats_interval", VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT, interval_value);
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj buffer_a;
+    VkBufferObj buffer_b;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    buffer_a.init_as_src_and_dst(*m_device, 256, mem_prop);
+    buffer_b.init_as_src_and_dst(*m_device, 256, mem_prop);
+    VkBufferCopy region = {0, 0, 256};
+
+    auto barrier = LvlInitStruct<VkMemoryBarrier>();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    m_commandBuffer->begin();
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    vk::CmdPipelineBarrier(m_commandBuffer->handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1,
+                           &barrier, 0, nullptr, 0, nullptr);
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer_a.handle(), buffer_b.handle(), 1, &region);
+    m_commandBuffer->end();
+
+    VkSubmitInfo submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    m_errorMonitor->ExpectSuccess(kErrorBit | kInformationBit);
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+    m_errorMonitor->VerifyNotFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(kInformationBit, "queue submits: 2\n");
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+    vk::QueueWaitIdle(m_device->m_queue);
+}
+
+#if GTEST_IS_THREADSAFE
+TEST_F(VkSyncValTest, SyncThreadRecordWhileDestroyEvent) {
+    TEST_DESCRIPTION("Record event commands on one thread while events are created, used and destroyed on another.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // The recording thread uses its own pool, as command recording is externally synchronized by pool
+    VkCommandPoolObj thread_pool(m_device, m_device->graphics_queue_node_index_);
+    VkCommandBufferObj thread_cb(m_device, &thread_pool);
+    vk_testing::Event thread_event(*m_device);
+
+    m_errorMonitor->ExpectSuccess();
+    thread_cb.begin();
+    std::atomic<bool> done{false};
+    std::thread recorder([&]() {
+        for (int i = 0; (i < 10000) && !done.load(); ++i) {
+            thread_event.cmd_set(thread_cb, VK_PIPELINE_STAGE_TRANSFER_BIT);
+            thread_event.cmd_reset(thread_cb, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        }
+    });
+
+    // Destroying an event must not touch the context of the command buffer recording on the other thread
+    for (int i = 0; i < 1000; ++i) {
+        VkCommandBufferObj cb(m_device, m_commandPool);
+        const auto event_ci = LvlInitStruct<VkEventCreateInfo>();
+        VkEvent event = VK_NULL_HANDLE;
+        vk::CreateEvent(m_device->device(), &event_ci, nullptr, &event);
+        cb.begin();
+        vk::CmdSetEvent(cb.handle(), event, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        cb.end();
+        vk::DestroyEvent(m_device->device(), event, nullptr);
+    }
+    done = true;
+    recorder.join();
+
+    thread_cb.end();
+    m_errorMonitor->VerifyNotFound();
+}
+#endif  // GTEST_IS_THREADSAFE